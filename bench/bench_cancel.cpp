@@ -0,0 +1,133 @@
+#include <benchmark/benchmark.h>
+
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+
+// ——————————————————————————————————————————
+// BENCHMARKS
+// ——————————————————————————————————————————
+
+// Where in a busy level's FIFO the cancelled order sits
+enum class QueuePosition { Front, Middle, Back };
+
+// One level holding `range(0)` orders. Each iteration cancels one order and
+// adds a replacement at the back, so the level keeps its size.
+static void BM_CancelFromBusyLevel(benchmark::State& state, QueuePosition position) {
+    OrderBook book;
+    std::deque<std::shared_ptr<IOrder>> queue;
+    for (int64_t n = 0; n < state.range(0); ++n) {
+        queue.push_back(OrderFactory::createLimitOrder(1, 100, OrderType::SELL));
+        book.addOrder(queue.back());
+    }
+
+    std::mt19937 rng{7};
+    for (auto _ : state) {
+        std::shared_ptr<IOrder> victim;
+        switch (position) {
+            case QueuePosition::Front:
+                victim = queue.front();
+                queue.pop_front();
+                break;
+            case QueuePosition::Back:
+                victim = queue.back();
+                queue.pop_back();
+                break;
+            case QueuePosition::Middle: {
+                // Anywhere but the ends; the harness swaps rather than shifts
+                const std::size_t i = 1 + rng() % (queue.size() - 2);
+                victim = queue[i];
+                queue[i] = queue.back();
+                queue.pop_back();
+                break;
+            }
+        }
+        book.cancel(victim->getId());
+
+        queue.push_back(OrderFactory::createLimitOrder(1, 100, OrderType::SELL));
+        book.addOrder(queue.back());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_CancelFromBusyLevel, Front,  QueuePosition::Front) ->Arg(10)->Arg(1000)->Arg(10'000);
+BENCHMARK_CAPTURE(BM_CancelFromBusyLevel, Middle, QueuePosition::Middle)->Arg(10)->Arg(1000)->Arg(10'000);
+BENCHMARK_CAPTURE(BM_CancelFromBusyLevel, Back,   QueuePosition::Back)  ->Arg(10)->Arg(1000)->Arg(10'000);
+
+// How BM_ModifyInBusyLevel amends its orders
+enum class Amendment { Reduce, Move, CancelAndAdd };
+
+// Two levels of `range(0)` pooled orders each. Each iteration amends one
+// order: Reduce takes one lot off in place; Move sends it to the other level
+// through modify; CancelAndAdd does the same move as a cancel and a fresh add.
+static void BM_ModifyInBusyLevel(benchmark::State& state, Amendment amendment) {
+    OrderBook book;
+    std::vector<std::string> ids;
+    for (int64_t n = 0; n < 2 * state.range(0); ++n) {
+        ids.push_back("o" + std::to_string(n));
+        book.addOrder(ids.back(), OrderType::SELL, 100 + n % 2, 1'000'000'000);
+    }
+    std::vector<int> quantities(ids.size(), 1'000'000'000);
+    std::vector<Price> prices(ids.size());
+    for (std::size_t n = 0; n < ids.size(); ++n) prices[n] = 100 + static_cast<Price>(n % 2);
+
+    std::mt19937 rng{7};
+    for (auto _ : state) {
+        const std::size_t i = rng() % ids.size();
+        switch (amendment) {
+            case Amendment::Reduce:
+                book.modify(ids[i], --quantities[i], prices[i]);
+                break;
+            case Amendment::Move:
+                prices[i] = 201 - prices[i];
+                book.modify(ids[i], quantities[i], prices[i]);
+                break;
+            case Amendment::CancelAndAdd:
+                prices[i] = 201 - prices[i];
+                book.cancel(ids[i]);
+                book.addOrder(ids[i], OrderType::SELL, prices[i], quantities[i]);
+                break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_ModifyInBusyLevel, Reduce,       Amendment::Reduce)      ->Arg(10)->Arg(1000);
+BENCHMARK_CAPTURE(BM_ModifyInBusyLevel, Move,         Amendment::Move)        ->Arg(10)->Arg(1000);
+BENCHMARK_CAPTURE(BM_ModifyInBusyLevel, CancelAndAdd, Amendment::CancelAndAdd)->Arg(10)->Arg(1000);
+
+// How BM_CancelAndReAdd names its orders
+enum class IdKind { Number, NumericText, Text };
+
+// `range(0)` resting pooled orders spread over 50 levels. Each iteration
+// cancels a random one and adds it back, so the cost is dominated by the two
+// id index operations once the book is large.
+static void BM_CancelAndReAdd(benchmark::State& state, IdKind kind) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    OrderBook book{PriceScale{}, BookStorage::Map, count};
+    std::vector<std::string> texts;
+    for (std::size_t n = 0; n < count; ++n) {
+        texts.push_back(kind == IdKind::Text ? "order-" + std::to_string(n) : std::to_string(n));
+        book.addOrder(texts.back(), OrderType::SELL, 100 + static_cast<Price>(n % 50), 1);
+    }
+
+    std::mt19937 rng{7};
+    for (auto _ : state) {
+        const std::size_t n = rng() % count;
+        const Price price = 100 + static_cast<Price>(n % 50);
+        if (kind == IdKind::Number) {
+            book.cancel(OrderId{n});
+            book.addOrder(OrderId{n}, OrderType::SELL, price, 1);
+        } else {
+            book.cancel(texts[n]);
+            book.addOrder(texts[n], OrderType::SELL, price, 1);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_CancelAndReAdd, Number,      IdKind::Number)     ->Arg(1000)->Arg(1'000'000);
+BENCHMARK_CAPTURE(BM_CancelAndReAdd, NumericText, IdKind::NumericText)->Arg(1000)->Arg(1'000'000);
+BENCHMARK_CAPTURE(BM_CancelAndReAdd, Text,        IdKind::Text)       ->Arg(1000)->Arg(1'000'000);
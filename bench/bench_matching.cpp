@@ -0,0 +1,211 @@
+#include <benchmark/benchmark.h>
+
+#include <climits>
+#include <cstdio>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "Engine/EngineClock.hpp"
+#include "Engine/OrderCommand.hpp"
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+#include "Observer/TradeLog.hpp"
+
+// ——————————————————————————————————————————
+// Helpers
+// ——————————————————————————————————————————
+
+// Seeds `depth` price levels on each side of the book, one order per level.
+// The best ask sits at 10'000 and the best bid at 9'999; every other level is
+// further away from the touch so an incoming order only ever crosses the best.
+static void seedBook(OrderBook& book, int depth) {
+    for (int level = 0; level < depth; ++level) {
+        book.addOrder(OrderFactory::createLimitOrder(INT_MAX, 10'000 + level, OrderType::SELL));
+        book.addOrder(OrderFactory::createLimitOrder(100,     9'999 - level,  OrderType::BUY));
+    }
+}
+
+// ——————————————————————————————————————————
+// BENCHMARKS
+// ——————————————————————————————————————————
+
+// An aggressive BUY that fills against the best ask. The best ask is seeded
+// with INT_MAX units so it never empties and every iteration does the same work.
+static void BM_AggressiveAddVsDepth(benchmark::State& state) {
+    OrderBook book;
+    seedBook(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        book.addOrder(OrderFactory::createLimitOrder(1, 10'000, OrderType::BUY));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AggressiveAddVsDepth)->RangeMultiplier(10)->Range(10, 100'000);
+
+// A passive BUY that rests at the touch without crossing, then is cancelled
+// so the book keeps the same shape between iterations.
+static void BM_PassiveAddVsDepth(benchmark::State& state) {
+    OrderBook book;
+    seedBook(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        auto order = OrderFactory::createLimitOrder(1, 9'999, OrderType::BUY);
+        book.addOrder(order);
+        book.removeOrder(order);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PassiveAddVsDepth)->RangeMultiplier(10)->Range(10, 100'000);
+
+// Same as BM_AggressiveAddVsDepth through the pooled-order API: no IOrder
+// object or event is created, and the fully filled taker frees its id again.
+static void BM_PooledAggressiveAddVsDepth(benchmark::State& state) {
+    OrderBook book;
+    seedBook(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        book.addOrder("taker", OrderType::BUY, 10'000, 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PooledAggressiveAddVsDepth)->RangeMultiplier(10)->Range(10, 100'000);
+
+// A marketable BUY under each time in force, filling in full against the best
+// ask. Matching happens before the order could rest, so none of them touches
+// the bid side; FillOrKill first checks the ask side can fill it.
+static void BM_MarketableAdd(benchmark::State& state, TimeInForce timeInForce) {
+    OrderBook book;
+    seedBook(book, 100);
+
+    for (auto _ : state) {
+        book.addOrder("taker", OrderType::BUY, 10'000, 1, timeInForce);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_MarketableAdd, GoodTillCancel,    TimeInForce::GoodTillCancel);
+BENCHMARK_CAPTURE(BM_MarketableAdd, ImmediateOrCancel, TimeInForce::ImmediateOrCancel);
+BENCHMARK_CAPTURE(BM_MarketableAdd, FillOrKill,        TimeInForce::FillOrKill);
+
+// A passive BUY resting `range(0)` levels behind the best bid of a book 1000
+// levels deep, then cancelled. Shows what finding or creating a level away
+// from the touch costs.
+static void BM_PassiveAddAtLevel(benchmark::State& state, BookStorage storage) {
+    OrderBook book{PriceScale{}, storage};
+    seedBook(book, 1000);
+    const Price price = 9'999 - state.range(0);
+
+    for (auto _ : state) {
+        book.addOrder("passive", OrderType::BUY, price, 1);
+        book.cancel("passive");
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_PassiveAddAtLevel, Map,    BookStorage::Map)   ->Arg(0)->Arg(10)->Arg(100)->Arg(999);
+BENCHMARK_CAPTURE(BM_PassiveAddAtLevel, Ladder, BookStorage::Ladder)->Arg(0)->Arg(10)->Arg(100)->Arg(999);
+
+// An aggressive BUY that sweeps `range(0)` ask levels of one order each. The
+// levels are put back with the timer paused, so only the sweep is measured.
+static void BM_SweepLevels(benchmark::State& state, BookStorage storage) {
+    const auto levels = static_cast<int>(state.range(0));
+    OrderBook book{PriceScale{}, storage};
+    for (int level = 0; level < 1000; ++level) {
+        book.addOrder("bid" + std::to_string(level), OrderType::BUY, 9'999 - level, 100);
+    }
+    std::vector<std::string> ids;
+    for (int level = 0; level < levels; ++level) ids.push_back("ask" + std::to_string(level));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int level = 0; level < levels; ++level) {
+            book.addOrder(ids[level], OrderType::SELL, 10'000 + level, 1);
+        }
+        state.ResumeTiming();
+
+        book.addOrder("sweeper", OrderType::BUY, 10'000 + levels - 1, levels);
+    }
+    state.counters["levels"] = levels;
+    state.SetItemsProcessed(state.iterations() * levels);
+}
+BENCHMARK_CAPTURE(BM_SweepLevels, Map,    BookStorage::Map)   ->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_SweepLevels, Ladder, BookStorage::Ladder)->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
+
+// A burst of `range(0)` passive adds with a trade-through at its end, then
+// the cancels that restore the book, logged by a synchronous TradeLog (one
+// flush per dispatch): command by command, or as one applyBatch per burst.
+static void BM_SubmitBurst(benchmark::State& state, bool batched) {
+    const std::string fname = "bench_burst.jsonl";
+    const auto size = static_cast<int>(state.range(0));
+
+    std::vector<OrderCommand> burst;
+    for (int i = 0; i < size; ++i) {
+        burst.push_back(OrderCommand::add("o" + std::to_string(i), OrderType::BUY, 9'990 - i % 10, 1));
+    }
+    burst.push_back(OrderCommand::add("taker", OrderType::BUY, 10'000, 1));
+    for (int i = 0; i < size; ++i) {
+        burst.push_back(OrderCommand::cancel("o" + std::to_string(i)));
+    }
+
+    {
+        OrderBook book;
+        seedBook(book, 100);
+        TradeLogOptions options;
+        options.retainEvents = 0;
+        book.addObserver(std::make_shared<TradeLog>(fname, options));
+
+        for (auto _ : state) {
+            if (batched) {
+                book.applyBatch(burst);
+            } else {
+                for (const auto& command : burst) applyCommand(book, command);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(burst.size()));
+    }
+    std::remove(fname.c_str());
+}
+BENCHMARK_CAPTURE(BM_SubmitBurst, Single,  false)->Arg(8)->Arg(64);
+BENCHMARK_CAPTURE(BM_SubmitBurst, Batched, true) ->Arg(8)->Arg(64);
+
+// An aggressive BUY that sweeps `range(0)` ask levels, with an observer that
+// takes every event, under clocks that read per event (the old behaviour) or
+// once per message. The levels are put back with the timer paused.
+struct EventCounter {
+    std::size_t events = 0;
+    void onEvents(std::span<const OrderEvent> batch) { events += batch.size(); }
+};
+
+static void BM_StampedSweep(benchmark::State& state, ClockSource source, Stamping stamping) {
+    const auto levels = static_cast<int>(state.range(0));
+    BasicOrderBook<PooledOrders, MapPrices, EventCounter> book;
+    book.setClock(EngineClock{source, stamping});
+    std::vector<std::string> ids;
+    for (int level = 0; level < levels; ++level) ids.push_back("ask" + std::to_string(level));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int level = 0; level < levels; ++level) {
+            book.addOrder(ids[level], OrderType::SELL, 10'000 + level, 1);
+        }
+        state.ResumeTiming();
+
+        book.addOrder("sweeper", OrderType::BUY, 10'000 + levels - 1, levels);
+    }
+    benchmark::DoNotOptimize(book.observer<EventCounter>().events);
+    state.SetItemsProcessed(state.iterations() * levels);
+}
+BENCHMARK_CAPTURE(BM_StampedSweep, SystemPerEvent,   ClockSource::System, Stamping::PerEvent)  ->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_StampedSweep, SystemPerMessage, ClockSource::System, Stamping::PerMessage)->Arg(10)->Arg(100);
+BENCHMARK_CAPTURE(BM_StampedSweep, TscPerMessage,    ClockSource::Tsc,    Stamping::PerMessage)->Arg(10)->Arg(100);
+
+// One clock read
+static void BM_ClockRead(benchmark::State& state, ClockSource source) {
+    EngineClock clock{source};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(clock.now());
+    }
+}
+BENCHMARK_CAPTURE(BM_ClockRead, System, ClockSource::System);
+BENCHMARK_CAPTURE(BM_ClockRead, Tsc,    ClockSource::Tsc);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "Engine/MultiBookEngine.hpp"
+
+// ——————————————————————————————————————————
+// Multi-symbol throughput against the number of shards
+// ——————————————————————————————————————————
+
+// One producer feeds symbols round-robin. Every symbol gets a resting sell
+// and a buy that takes it out, so each shard does the same matching work per
+// symbol; throughput should grow with the shard count up to the core count.
+
+namespace {
+    constexpr int symbolCount = 64;
+
+    using ShardBook = BasicOrderBook<PooledOrders, LadderPrices>;
+
+    struct Workload {
+        std::vector<std::string>  symbols;
+        std::vector<OrderCommand> commands;   // symbol i % symbolCount
+
+        explicit Workload(int pairsPerSymbol) {
+            for (int s = 0; s < symbolCount; ++s) {
+                symbols.push_back("SYM" + std::to_string(s));
+            }
+            for (int i = 0; i < pairsPerSymbol; ++i) {
+                const std::string n = std::to_string(i);
+                const Price price = 10'000 + i % 16;
+                for (int s = 0; s < symbolCount; ++s) {
+                    commands.push_back(OrderCommand::add("s" + n, OrderType::SELL, price, 1));
+                    commands.push_back(OrderCommand::add("b" + n, OrderType::BUY, price, 1));
+                }
+            }
+        }
+
+        std::string_view symbolOf(std::size_t command) const { return symbols[(command / 2) % symbolCount]; }
+    };
+
+    void shardCounts(benchmark::internal::Benchmark* bench) {
+        const int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        for (int shards = 1; shards < cores; shards *= 2) {
+            bench->Args({shards, 5'000});
+        }
+        bench->Args({cores, 5'000});
+    }
+}
+
+static void BM_MultiBookThroughput(benchmark::State& state) {
+    const auto shards = static_cast<std::size_t>(state.range(0));
+    const auto pairs  = static_cast<int>(state.range(1));
+    const Workload workload{pairs};
+
+    for (auto _ : state) {
+        MultiBookEngine<ShardBook> engine{workload.symbols,
+                                          EngineOptions{shards, RunnerOptions{1 << 14, Backpressure::Yield}},
+                                          [&](std::string_view) {
+                                              return std::make_unique<ShardBook>(PriceScale{}, LadderPrices{}, 64);
+                                          }};
+
+        const auto start = std::chrono::steady_clock::now();
+        engine.start();
+        for (std::size_t i = 0; i < workload.commands.size(); ++i) {
+            engine.submit(workload.symbolOf(i), workload.commands[i]);
+        }
+        engine.stop();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        state.SetIterationTime(elapsed.count());
+    }
+
+    state.counters["shards"] = static_cast<double>(shards);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(workload.commands.size()));
+}
+BENCHMARK(BM_MultiBookThroughput)->Apply(shardCounts)->UseManualTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,75 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Book snapshots through getBuyOrders()/getSellOrders(), against reading the
+// book in place through forEachLevel() and getDepth()
+// ——————————————————————————————————————————
+
+// `range(0)` levels a side with 4 orders each; each call copies the whole side
+static void seedLevels(OrderBook& book, int levels) {
+    for (int level = 0; level < levels; ++level) {
+        for (int i = 0; i < 4; ++i) {
+            const std::string suffix = std::to_string(level) + "_" + std::to_string(i);
+            book.addOrder("s" + suffix, OrderType::SELL, 10'000 + level, 1);
+            book.addOrder("b" + suffix, OrderType::BUY,  9'999 - level,  1);
+        }
+    }
+}
+
+static void BM_GetBuyOrders(benchmark::State& state) {
+    OrderBook book;
+    seedLevels(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.getBuyOrders());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(BM_GetBuyOrders)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BM_GetSellOrders(benchmark::State& state) {
+    OrderBook book;
+    seedLevels(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.getSellOrders());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(BM_GetSellOrders)->Arg(10)->Arg(100)->Arg(1000);
+
+// Reads every buy order in place, as getBuyOrders() would copy them
+static void BM_VisitBuyOrders(benchmark::State& state) {
+    OrderBook book;
+    seedLevels(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        std::int64_t quantity = 0;
+        book.forEachLevel(OrderType::BUY, [&](const LevelView<OrderBook::Node>& level) {
+            for (const auto& order : level) quantity += order.quantity;
+        });
+        benchmark::DoNotOptimize(quantity);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 4);
+}
+BENCHMARK(BM_VisitBuyOrders)->Arg(10)->Arg(100)->Arg(1000);
+
+// The best 10 levels of a side from the level totals, however deep the book
+static void BM_GetDepthTop10(benchmark::State& state) {
+    OrderBook book;
+    seedLevels(book, static_cast<int>(state.range(0)));
+    std::vector<DepthLevel> depth(10);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(book.getDepth(OrderType::BUY, depth));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 10);
+}
+BENCHMARK(BM_GetDepthTop10)->Arg(10)->Arg(100)->Arg(1000);
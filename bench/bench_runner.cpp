@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "Engine/EngineRunner.hpp"
+#include "OrderFactory.hpp"
+
+// ——————————————————————————————————————————
+// Enqueue → trade latency through the engine runner
+// ——————————————————————————————————————————
+
+// The producer alternately submits a resting sell and a buy that takes it
+// out. Each submit is stamped just before it is enqueued; the matching thread
+// stamps every trade as it is reported and attributes it to the add command
+// being applied (the n-th ADD event belongs to the n-th add command).
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    std::int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    struct LatencyProbe {
+        const std::vector<std::int64_t>* enqueuedAt = nullptr;   // by add command
+        std::vector<std::int64_t>*       latencies  = nullptr;
+        std::size_t                      adds       = 0;
+
+        void onEvent(const OrderEvent& ev) {
+            if (ev.type == OrderEventType::ADD) {
+                ++adds;
+            } else if (ev.type == OrderEventType::MATCH) {
+                latencies->push_back(nowNs() - (*enqueuedAt)[adds - 1]);
+            }
+        }
+    };
+
+    using RunnerBook = BasicOrderBook<PooledOrders, LadderPrices, LatencyProbe>;
+
+    double percentile(std::vector<std::int64_t>& sorted, double p) {
+        if (sorted.empty()) return 0;
+        const auto i = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+        return static_cast<double>(sorted[i]);
+    }
+}
+
+static void BM_RunnerEnqueueToTrade(benchmark::State& state, Backpressure backpressure) {
+    constexpr Price price = 10'000;
+    const auto pairs = static_cast<std::size_t>(state.range(0));
+
+    std::vector<std::string> ids;
+    for (std::size_t i = 0; i < pairs; ++i) {
+        ids.push_back("s" + std::to_string(i));
+        ids.push_back("b" + std::to_string(i));
+    }
+    std::vector<std::int64_t> enqueuedAt(2 * pairs);
+    std::vector<std::int64_t> latencies;
+    latencies.reserve(pairs * 64);
+
+    for (auto _ : state) {
+        RunnerBook book{PriceScale{}, LadderPrices{}, 2 * pairs, LatencyProbe{&enqueuedAt, &latencies}};
+        EngineRunner runner{book, RunnerOptions{1024, backpressure}};
+
+        for (std::size_t i = 0; i < pairs; ++i) {
+            enqueuedAt[2 * i] = nowNs();
+            runner.addOrder(ids[2 * i], OrderType::SELL, price, 1);
+            enqueuedAt[2 * i + 1] = nowNs();
+            runner.addOrder(ids[2 * i + 1], OrderType::BUY, price, 1);
+        }
+        runner.stop();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ns"]  = percentile(latencies, 0.50);
+    state.counters["p99_ns"]  = percentile(latencies, 0.99);
+    state.counters["p999_ns"] = percentile(latencies, 0.999);
+    state.counters["max_ns"]  = latencies.empty() ? 0 : static_cast<double>(latencies.back());
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(2 * pairs));
+}
+BENCHMARK_CAPTURE(BM_RunnerEnqueueToTrade, Spin,  Backpressure::Spin) ->Arg(10'000)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RunnerEnqueueToTrade, Yield, Backpressure::Yield)->Arg(10'000)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ——————————————————————————————————————————
+// Order ids handed out to several producer threads
+// ——————————————————————————————————————————
+
+// Per-thread blocks: the shared counter is written once per 4096 ids
+static void BM_NextOrderId(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(OrderFactory::nextId());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_NextOrderId)->Threads(1)->Threads(4);
+
+// The alternative: one shared atomic, written for every id
+static std::atomic<std::uint64_t> sharedOrderId{0};
+static void BM_SharedAtomicOrderId(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sharedOrderId.fetch_add(1, std::memory_order_relaxed));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SharedAtomicOrderId)->Threads(1)->Threads(4);
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Snapshot save and restart from a snapshot
+// ——————————————————————————————————————————
+
+namespace {
+    const std::string snapshotFile = "bench_book.snapshot";
+
+    // `orders` resting orders over 1000 levels a side, no crossing
+    void fillBook(OrderBook& book, std::int64_t orders) {
+        for (std::int64_t i = 0; i < orders; ++i) {
+            const bool sell = i % 2 == 0;
+            book.addOrder(std::to_string(i), sell ? OrderType::SELL : OrderType::BUY,
+                          sell ? 10'000 + i % 1000 : 9'000 - i % 1000, 1 + static_cast<int>(i % 9));
+        }
+    }
+}
+
+static void BM_SaveSnapshot(benchmark::State& state) {
+    OrderBook book{PriceScale{}, BookStorage::Map, static_cast<std::size_t>(state.range(0))};
+    fillBook(book, state.range(0));
+
+    for (auto _ : state) {
+        book.saveSnapshot(snapshotFile, 1);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(snapshotFile.c_str());
+}
+BENCHMARK(BM_SaveSnapshot)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
+
+// Restart time: an empty book loads a snapshot of `range(0)` orders
+static void BM_LoadSnapshot(benchmark::State& state) {
+    {
+        OrderBook book{PriceScale{}, BookStorage::Map, static_cast<std::size_t>(state.range(0))};
+        fillBook(book, state.range(0));
+        book.saveSnapshot(snapshotFile, 1);
+    }
+
+    for (auto _ : state) {
+        auto book = std::make_unique<OrderBook>();
+        book->loadSnapshot(snapshotFile);
+        benchmark::DoNotOptimize(book->getOrderCount());
+        state.PauseTiming();   // not the teardown
+        book.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove(snapshotFile.c_str());
+}
+BENCHMARK(BM_LoadSnapshot)->Arg(1 << 20)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "BasicOrderBook.hpp"
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+
+// ——————————————————————————————————————————
+// Virtual vs compile-time-specialized book
+// ——————————————————————————————————————————
+
+// Each iteration rests a sell one tick above the touch and takes it out with
+// a buy, so every iteration is two adds, one trade reported to one observer
+// and one fill, on a book seeded `depth` levels deep on each side.
+
+namespace {
+    constexpr Price mid = 10'000;
+
+    // The same observer both ways: through IOrderObserver and as a static hook
+    struct VirtualTradeCounter : IOrderObserver {
+        long trades = 0;
+        void onOrderEvent(const OrderEvent& ev) override {
+            if (ev.type == OrderEventType::MATCH) ++trades;
+        }
+    };
+
+    struct StaticTradeCounter {
+        long trades = 0;
+        void onEvent(const OrderEvent& ev) {
+            if (ev.type == OrderEventType::MATCH) ++trades;
+        }
+    };
+
+    template <typename Book>
+    void seedPooled(Book& book, int depth) {
+        for (int level = 1; level <= depth; ++level) {
+            book.addOrder("ask" + std::to_string(level), OrderType::SELL, mid + 1 + level, 10);
+            book.addOrder("bid" + std::to_string(level), OrderType::BUY, mid - level, 10);
+        }
+    }
+}
+
+// OrderBook with IOrder objects: virtual order access, runtime storage
+// dispatch and a virtual observer call
+static void BM_VirtualBook(benchmark::State& state) {
+    OrderBook book;
+    auto counter = std::make_shared<VirtualTradeCounter>();
+    book.addObserver(counter);
+    for (int level = 1; level <= state.range(0); ++level) {
+        book.addOrder(OrderFactory::createLimitOrder(10, mid + 1 + level, OrderType::SELL));
+        book.addOrder(OrderFactory::createLimitOrder(10, mid - level, OrderType::BUY));
+    }
+
+    for (auto _ : state) {
+        book.addOrder(OrderFactory::createLimitOrder(10, mid + 1, OrderType::SELL));
+        book.addOrder(OrderFactory::createLimitOrder(10, mid + 1, OrderType::BUY));
+    }
+    benchmark::DoNotOptimize(counter->trades);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_VirtualBook)->Arg(10)->Arg(1000);
+
+// OrderBook's pooled API: no IOrder objects, but still the runtime storage
+// dispatch and the IOrderObserver bridge
+static void BM_OrderBookPooled(benchmark::State& state) {
+    OrderBook book;
+    auto counter = std::make_shared<VirtualTradeCounter>();
+    book.addObserver(counter);
+    seedPooled(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        book.addOrder("s", OrderType::SELL, mid + 1, 10);
+        book.addOrder("b", OrderType::BUY, mid + 1, 10);
+    }
+    benchmark::DoNotOptimize(counter->trades);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OrderBookPooled)->Arg(10)->Arg(1000);
+
+// Everything fixed at compile time: pooled nodes, one storage, inlined observer
+template <typename PricePolicy>
+static void BM_StaticBook(benchmark::State& state) {
+    BasicOrderBook<PooledOrders, PricePolicy, StaticTradeCounter> book;
+    seedPooled(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        book.addOrder("s", OrderType::SELL, mid + 1, 10);
+        book.addOrder("b", OrderType::BUY, mid + 1, 10);
+    }
+    benchmark::DoNotOptimize(book.template observer<StaticTradeCounter>().trades);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(BM_StaticBook, MapPrices)   ->Arg(10)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_StaticBook, LadderPrices)->Arg(10)->Arg(1000);
@@ -0,0 +1,82 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+
+// ——————————————————————————————————————————
+// Near-touch order flow
+// ——————————————————————————————————————————
+
+// A synthetic but realistic message mix: most activity is passive quoting and
+// cancelling within a few ticks of the touch, with occasional marketable
+// orders that take liquidity from the best levels.
+class NearTouchFlow {
+private:
+    static constexpr Price mid = 10'000;
+
+    std::mt19937                         rng{42};
+    std::vector<std::shared_ptr<IOrder>> live;
+
+public:
+    // Seeds `depth` levels on each side, a few orders per level
+    void seed(OrderBook& book, int depth) {
+        for (int level = 1; level <= depth; ++level) {
+            for (int n = 0; n < 4; ++n) {
+                live.push_back(OrderFactory::createLimitOrder(10, mid + level, OrderType::SELL));
+                book.addOrder(live.back());
+                live.push_back(OrderFactory::createLimitOrder(10, mid - level, OrderType::BUY));
+                book.addOrder(live.back());
+            }
+        }
+    }
+
+    void step(OrderBook& book) {
+        const unsigned roll = rng() % 100;
+        const OrderType side = (rng() & 1) ? OrderType::BUY : OrderType::SELL;
+
+        if (roll < 50 || live.empty()) {
+            // Passive quote 1..10 ticks behind the touch
+            const Price offset = 1 + static_cast<Price>(rng() % 10);
+            const Price price = side == OrderType::BUY ? mid - offset : mid + offset;
+            live.push_back(OrderFactory::createLimitOrder(10, price, side));
+            book.addOrder(live.back());
+        } else if (roll < 95) {
+            // Cancel a random live order (fills may have emptied it already)
+            const std::size_t i = rng() % live.size();
+            if (live[i]->getQuantity() > 0) {
+                book.removeOrder(live[i]);
+            }
+            live[i] = live.back();
+            live.pop_back();
+        } else {
+            // Marketable order reaching up to 3 ticks through the touch
+            const Price price = side == OrderType::BUY ? mid + 3 : mid - 3;
+            auto order = OrderFactory::createLimitOrder(15, price, side);
+            book.addOrder(order);
+            if (order->getQuantity() > 0) {
+                book.removeOrder(order);
+            }
+        }
+    }
+};
+
+// ——————————————————————————————————————————
+// BENCHMARKS
+// ——————————————————————————————————————————
+
+static void BM_NearTouchFlow(benchmark::State& state, BookStorage storage) {
+    OrderBook book{PriceScale{}, storage};
+    NearTouchFlow flow;
+    flow.seed(book, static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        flow.step(book);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(BM_NearTouchFlow, Map,    BookStorage::Map)   ->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_NearTouchFlow, Ladder, BookStorage::Ladder)->Arg(10)->Arg(100)->Arg(1000);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "Observer/EventJournal.hpp"
+#include "Observer/TradeLog.hpp"
+
+// ——————————————————————————————————————————
+// Cost of logging on the matching thread
+// ——————————————————————————————————————————
+
+// Each iteration rests a sell and crosses it with a buy (ADD, ADD, MATCH) on a
+// book logging to a file. Only the caller's time is measured: in async mode
+// formatting and disk writes happen on the writer thread.
+static void BM_TradeLogOnMatchPath(benchmark::State& state, TradeLogMode mode) {
+    const std::string fname = "bench_tradelog.jsonl";
+    std::vector<std::string> ids;
+    for (int i = 0; i < 1024; ++i) ids.push_back(std::to_string(i));
+
+    {
+        OrderBook book;
+        auto log = std::make_shared<TradeLog>(fname, TradeLogOptions{mode});
+        book.addObserver(log);
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            const std::string& id = ids[i++ % ids.size()];
+            book.addOrder("s" + id, OrderType::SELL, 100, 1);
+            book.addOrder("b" + id, OrderType::BUY, 100, 1);
+        }
+        state.SetItemsProcessed(state.iterations() * 2);
+        log->close();
+    }
+    std::remove(fname.c_str());
+}
+BENCHMARK_CAPTURE(BM_TradeLogOnMatchPath, Sync,  TradeLogMode::Sync);
+BENCHMARK_CAPTURE(BM_TradeLogOnMatchPath, Async, TradeLogMode::Async);
+
+// The same workload recorded in the binary journal instead
+static void BM_EventJournalOnMatchPath(benchmark::State& state) {
+    const std::string fname = "bench_journal.bin";
+    std::vector<std::string> ids;
+    for (int i = 0; i < 1024; ++i) ids.push_back(std::to_string(i));
+
+    {
+        OrderBook book;
+        auto journal = std::make_shared<EventJournal>(fname);
+        book.addObserver(journal);
+
+        std::size_t i = 0;
+        for (auto _ : state) {
+            const std::string& id = ids[i++ % ids.size()];
+            book.addOrder("s" + id, OrderType::SELL, 100, 1);
+            book.addOrder("b" + id, OrderType::BUY, 100, 1);
+        }
+        state.SetItemsProcessed(state.iterations() * 2);
+        journal->close();
+    }
+    std::remove(fname.c_str());
+}
+BENCHMARK(BM_EventJournalOnMatchPath);
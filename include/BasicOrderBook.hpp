@@ -0,0 +1,937 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Price.hpp"
+#include "Interfaces/IOrder.hpp"
+#include "Events/LevelUpdate.hpp"
+#include "Events/OrderEvent.hpp"
+#include "Book/OrderNode.hpp"
+#include "Book/OrderPolicies.hpp"
+#include "Book/OrderPool.hpp"
+#include "Book/OrderIndex.hpp"
+#include "Book/LevelView.hpp"
+#include "Book/PriceLevel.hpp"
+#include "Book/PricePolicies.hpp"
+#include "Book/TopOfBook.hpp"
+#include "Engine/EngineClock.hpp"
+#include "Engine/OrderCommand.hpp"
+#include "Engine/SeqLock.hpp"
+#include "MatchingEngine.hpp"
+#include "Stats/BookStats.hpp"
+
+// An observer the book delivers OrderEvents to: either a whole operation's
+// events at once through onEvents, or one at a time through onEvent
+template <typename Observer>
+concept OrderEventObserver =
+    requires(Observer& observer, std::span<const OrderEvent> events) { observer.onEvents(events); } ||
+    requires(Observer& observer, const OrderEvent& event) { observer.onEvent(event); };
+
+// An observer the book delivers L2 deltas to: the levels each operation
+// changed, through onLevelUpdates
+template <typename Observer>
+concept LevelUpdateObserver =
+    requires(Observer& observer, std::span<const LevelUpdate> updates) { observer.onLevelUpdates(updates); };
+
+// Outcome of a batch of orders or commands applied to a book
+struct BatchResult {
+    std::size_t applied  = 0;
+    std::size_t rejected = 0;   // adds the book refused, cancels of orders not resting
+};
+
+// Order book whose order representation, level storage and observers are all
+// fixed at compile time, so the whole add/match/cancel path is inlined with no
+// virtual dispatch:
+//
+//   OrderPolicy  provides the Node type orders are pooled in (PooledOrders,
+//                SharedOrders)
+//   PricePolicy  provides the level storage (MapPrices, LadderPrices,
+//                RuntimePrices)
+//   Observers    are held by value and called directly (OrderEventObserver).
+//                An observer may also define bool wantsEvents() const; while
+//                none wants them, no events are built at all. Observers of
+//                L2 deltas (LevelUpdateObserver) may likewise define
+//                bool wantsLevelUpdates() const.
+//
+// Events are built in place in a buffer the book reuses, and handed out once
+// the operation that raised them is complete, so observers may call back into
+// the book. A book with no event observers never builds any.
+//
+// Every level keeps its total quantity and order count, so depth queries
+// (getDepth) and L2 deltas never walk individual orders. The best bid and
+// offer are cached after every operation, and also published through a
+// seqlock so other threads can read them while the book trades
+// (loadTopOfBook).
+//
+// The book can be read in place through forEachLevel: LevelViews of its
+// levels and the nodes of their orders, with no copying or allocation. Those
+// views, like any reference into the book, are invalidated by the next
+// operation that modifies it (add, cancel, modify, match, snapshot load) and
+// must not be used across one; visitors must not modify the book themselves.
+//
+// Orders and events are timestamped by the book's EngineClock: by default
+// the calibrated cycle counter, read once per inbound message, so every
+// event of a sweep carries the same time (see getClock/setClock).
+//
+// Unless built with ORDERBOOK_STATS=0, every add, cancel, modify and matching
+// pass is timed into per-book histograms (getStats()).
+//
+// OrderBook is the instantiation with IOrder objects, runtime-selected
+// storage and dynamically registered observers.
+template <typename OrderPolicy, typename PricePolicy, typename... Observers>
+class BasicOrderBook {
+public:
+    using Node  = typename OrderPolicy::Node;
+    using Level = PriceLevel<Node>;
+    using Sides = typename PricePolicy::template Sides<Level>;
+
+private:
+    // A resting order filled by the current match, kept until its trade has
+    // been reported
+    struct Fill {
+        Node* resting;
+        int   quantity;
+    };
+
+    // A level changed by the operation in progress
+    struct TouchedLevel {
+        OrderType side;
+        Price     price;
+
+        bool operator==(const TouchedLevel&) const = default;
+        bool operator<(const TouchedLevel& other) const {
+            return side != other.side ? side < other.side : price < other.price;
+        }
+    };
+
+    PricePolicy                prices;
+    Sides                      sides;
+    // Every resting order lives in the pool; the index maps ids to its handles
+    OrderPool<Node>            orders;
+    OrderIndex                 orderIndex;
+    std::vector<Fill>          fills;
+    std::tuple<Observers...>   observers;
+    PriceScale                 priceScale;
+    EngineClock                clock;
+
+    // Events of the operation in progress, and the buffer they swap with
+    // while being published
+    std::vector<OrderEvent>    events;
+    std::vector<OrderEvent>    spareEvents;
+    // Numbers this book's events from 1, whether or not anyone records them;
+    // each book counts on its own, so books on different threads share nothing
+    std::uint64_t              eventSequence = 0;
+    // While a batch runs, its operations publish nothing; the batch does,
+    // once, at the end
+    bool                       batching = false;
+
+    // Levels changed by the operation in progress, and the L2 deltas built
+    // from them, while anyone is listening for those
+    std::vector<TouchedLevel>  touchedLevels;
+    std::vector<LevelUpdate>   levelUpdates;
+    std::vector<LevelUpdate>   spareLevelUpdates;
+
+    // Best bid and offer after the last operation, and its copy for other
+    // threads (written only when it changes)
+    TopOfBook                  top;
+    SeqLock<TopOfBook>         publishedTop;
+
+    [[no_unique_address]] ActiveBookStats stats;
+
+    static constexpr bool hasEventObservers = (OrderEventObserver<Observers> || ...);
+    static constexpr bool hasDepthObservers = (LevelUpdateObserver<Observers> || ...);
+
+    template <typename Observer>
+    static bool wantsEvents(const Observer& observer) {
+        if constexpr (!OrderEventObserver<Observer>) {
+            return false;
+        } else if constexpr (requires { observer.wantsEvents(); }) {
+            return observer.wantsEvents();
+        } else {
+            return true;
+        }
+    }
+
+    bool recording() const {
+        if constexpr (hasEventObservers) {
+            return std::apply([](const auto&... observer) { return (wantsEvents(observer) || ...); }, observers);
+        } else {
+            return false;
+        }
+    }
+
+    template <typename Observer>
+    static bool wantsLevelUpdates(const Observer& observer) {
+        if constexpr (!LevelUpdateObserver<Observer>) {
+            return false;
+        } else if constexpr (requires { observer.wantsLevelUpdates(); }) {
+            return observer.wantsLevelUpdates();
+        } else {
+            return true;
+        }
+    }
+
+    bool trackingLevels() const {
+        if constexpr (hasDepthObservers) {
+            return std::apply([](const auto&... observer) { return (wantsLevelUpdates(observer) || ...); }, observers);
+        } else {
+            return false;
+        }
+    }
+
+    // Notes that a level changed, if anyone wants L2 deltas. A sweep touches
+    // the same level many times in a row; those collapse here, the rest when
+    // the deltas are built.
+    void touchLevel(OrderType side, Price price) {
+        if constexpr (hasDepthObservers) {
+            if (!trackingLevels()) {
+                return;
+            }
+            const TouchedLevel level{side, price};
+            if (touchedLevels.empty() || !(touchedLevels.back() == level)) {
+                touchedLevels.push_back(level);
+            }
+        }
+    }
+
+    Level* findLevel(OrderType side, Price price) {
+        return PricePolicy::visit(sides, [&](auto& s) {
+            return side == OrderType::BUY ? s.buyOrders.find(price) : s.sellOrders.find(price);
+        });
+    }
+
+    // Turns the touched levels into deltas carrying each level's final state
+    void buildLevelUpdates() {
+        std::sort(touchedLevels.begin(), touchedLevels.end());
+        touchedLevels.erase(std::unique(touchedLevels.begin(), touchedLevels.end()), touchedLevels.end());
+        for (const auto& touched : touchedLevels) {
+            LevelUpdate& update = levelUpdates.emplace_back();
+            update.side     = touched.side;
+            update.sequence = eventSequence;
+            update.level    = DepthLevel{touched.price, 0, 0};
+            if (const Level* level = findLevel(touched.side, touched.price)) {
+                update.level.quantity   = level->quantity();
+                update.level.orderCount = static_cast<std::uint32_t>(level->size());
+            }
+        }
+        touchedLevels.clear();
+    }
+
+    static void snapshot(OrderSnapshot& into, const Node& node) {
+        char digits[maxOrderIdDigits];
+        into.setId(node.getId(digits));
+        into.side     = node.side;
+        into.price    = node.price;
+        into.quantity = node.quantity;
+    }
+
+    // Numbers the next event and, if anyone is listening, appends it to the
+    // buffer; returns nullptr otherwise
+    OrderEvent* record(OrderEventType type) {
+        ++eventSequence;
+        if (!recording()) {
+            return nullptr;
+        }
+        OrderEvent& event = events.emplace_back();
+        event.type      = type;
+        event.sequence  = eventSequence;
+        event.timestamp = clock.stamp();
+        return &event;
+    }
+
+    void recordOrder(OrderEventType type, const Node& node) {
+        if (OrderEvent* event = record(type)) {
+            snapshot(event->order, node);
+            event->quantity = node.quantity;
+        }
+    }
+
+    // A fill of an incoming order against a resting one. Trades are
+    // recorded once the whole sweep is done, so the incoming order is shown
+    // with incomingLeft, what it had left right after this fill.
+    void recordTrade(const Node& incoming, const Node& resting, int quantity, int incomingLeft) {
+        if (OrderEvent* event = record(OrderEventType::MATCH)) {
+            const bool buying = incoming.side == OrderType::BUY;
+            OrderSnapshot& taker = buying ? event->order : event->contra;
+            snapshot(taker, incoming);
+            taker.quantity = incomingLeft;
+            snapshot(buying ? event->contra : event->order, resting);
+            event->quantity = quantity;
+        }
+    }
+
+    template <typename Levels>
+    static DepthLevel bestOf(Levels& levels) {
+        if (levels.empty()) {
+            return DepthLevel{};
+        }
+        const Level& level = levels.bestLevel();
+        return DepthLevel{levels.bestPrice(), level.quantity(), static_cast<std::uint32_t>(level.size())};
+    }
+
+    void refreshTopOfBook() {
+        TopOfBook now;
+        PricePolicy::visit(sides, [&](auto& s) {
+            now.bid = bestOf(s.buyOrders);
+            now.ask = bestOf(s.sellOrders);
+        });
+        if (!(now == top)) {
+            top = now;
+            publishedTop.store(now);
+        }
+    }
+
+    // Updates the top of book, then hands the buffered events and the
+    // operation's L2 deltas to every observer that takes them
+    void publish() {
+        if (batching) {
+            return;
+        }
+        refreshTopOfBook();
+        if constexpr (hasDepthObservers) {
+            // Built before any observer runs, while the levels still show
+            // this operation's outcome
+            if (!touchedLevels.empty()) {
+                buildLevelUpdates();
+            }
+        }
+        publishEvents();
+        publishLevelUpdates();
+    }
+
+    void publishEvents() {
+        if constexpr (hasEventObservers) {
+            if (events.empty()) {
+                return;
+            }
+
+            // An observer may call back into the book and publish events of
+            // its own; take this batch out of the way first
+            std::vector<OrderEvent> batch = std::exchange(events, std::move(spareEvents));
+            events.clear();
+            const std::span<const OrderEvent> view{batch};
+            std::apply([&](auto&... observer) {
+                auto deliver = [&](auto& o) {
+                    if constexpr (requires { o.onEvents(view); }) {
+                        o.onEvents(view);
+                    } else if constexpr (OrderEventObserver<std::remove_reference_t<decltype(o)>>) {
+                        for (const auto& event : view) o.onEvent(event);
+                    }
+                };
+                (deliver(observer), ...);
+            }, observers);
+
+            batch.clear();
+            spareEvents = std::move(batch);
+        }
+    }
+
+    void publishLevelUpdates() {
+        if constexpr (hasDepthObservers) {
+            if (levelUpdates.empty()) {
+                return;
+            }
+
+            std::vector<LevelUpdate> batch = std::exchange(levelUpdates, std::move(spareLevelUpdates));
+            levelUpdates.clear();
+            const std::span<const LevelUpdate> view{batch};
+            std::apply([&](auto&... observer) {
+                auto deliver = [&](auto& o) {
+                    if constexpr (LevelUpdateObserver<std::remove_reference_t<decltype(o)>>) {
+                        o.onLevelUpdates(view);
+                    }
+                };
+                (deliver(observer), ...);
+            }, observers);
+
+            batch.clear();
+            spareLevelUpdates = std::move(batch);
+        }
+    }
+
+    // Whether the storage of a side could hold a level at price
+    bool fits(OrderType side, Price price) {
+        return PricePolicy::visit(sides, [&](auto& s) {
+            return side == OrderType::BUY ? s.buyOrders.fits(price) : s.sellOrders.fits(price);
+        });
+    }
+
+    // queues a node behind the orders already at its level, creating the
+    // level if need be
+    void enqueue(Node& node) {
+        PricePolicy::visit(sides, [&](auto& s) {
+            if (node.side == OrderType::BUY) {
+                s.buyOrders.getOrCreate(node.price).push_back(node);
+            } else {
+                s.sellOrders.getOrCreate(node.price).push_back(node);
+            }
+        });
+    }
+
+    // unlinks a resting order from its level, dropping the level if it empties
+    void unlink(Node& node) {
+        touchLevel(node.side, node.price);
+        PricePolicy::visit(sides, [&](auto& s) {
+            auto unlinkFrom = [&](auto& levels) {
+                if (auto* level = levels.find(node.price)) {
+                    level->erase(node);
+                    if (level->empty()) levels.erase(node.price);
+                }
+            };
+            if (node.side == OrderType::BUY) {
+                unlinkFrom(s.buyOrders);
+            } else {
+                unlinkFrom(s.sellOrders);
+            }
+        });
+    }
+
+    // unlinks, unindexes and frees a resting order
+    void retire(Node& node) {
+        unlink(node);
+        orderIndex.erase(node.key, node.handle);
+        orders.release(node);
+    }
+
+    // The resting order with this index key and id text
+    OrderHandle findHandle(OrderId key, std::string_view orderId) const {
+        if ((key & textKeyBit) == 0) {
+            return orderIndex.find(key);
+        }
+        return orderIndex.find(key, [&](OrderHandle handle) { return orders[handle].textId == orderId; });
+    }
+
+    bool cancelNode(Node* node, std::uint64_t startedAt) {
+        if (node == nullptr) {
+            return false;
+        }
+
+        recordOrder(OrderEventType::REMOVE, *node);
+        retire(*node);
+        publish();
+        stats.finish(BookOperation::Cancel, startedAt, orders.size());
+        return true;
+    }
+
+    bool modifyNode(Node* node, int quantity, Price price, std::uint64_t startedAt) {
+        if (quantity <= 0) {
+            throw std::invalid_argument("OrderBook: order quantity must be positive");
+        }
+        if (node == nullptr) {
+            return false;
+        }
+        if (price == node->price && quantity == node->quantity) {
+            return true;
+        }
+        if (price != node->price && !fits(node->side, price)) {
+            throw std::length_error("OrderBook: price range exceeds ladder capacity");
+        }
+
+        OrderEvent* event = record(OrderEventType::MODIFY);
+        if (event != nullptr) {
+            snapshot(event->contra, *node);
+        }
+        if (price == node->price && quantity < node->quantity) {
+            findLevel(node->side, node->price)->fill(*node, node->quantity - quantity);
+            touchLevel(node->side, node->price);
+            if (event != nullptr) {
+                snapshot(event->order, *node);
+                event->quantity = quantity;
+            }
+        } else {
+            unlink(*node);
+            node->amend(price, quantity);
+            node->timestamp = clock.stamp();
+            if (event != nullptr) {
+                snapshot(event->order, *node);
+                event->quantity = quantity;
+            }
+            sweep(*node);
+            if (node->quantity == 0) {
+                orderIndex.erase(node->key, node->handle);
+                orders.release(*node);
+            } else {
+                try {
+                    enqueue(*node);
+                } catch (...) {
+                    // Only a failed allocation gets here; the order is gone
+                    orderIndex.erase(node->key, node->handle);
+                    orders.release(*node);
+                    publish();
+                    throw;
+                }
+                touchLevel(node->side, node->price);
+            }
+        }
+        publish();
+        stats.finish(BookOperation::Modify, startedAt, orders.size());
+        return true;
+    }
+
+protected:
+    Node&       acquireNode()                       { return orders.acquire(); }
+    Node*       findNode(std::string_view orderId)  {
+        const OrderHandle handle = findHandle(orderKey(orderId), orderId);
+        return handle == nullHandle ? nullptr : &orders[handle];
+    }
+    Node*       findNode(OrderId orderId) {
+        const OrderHandle handle = orderId <= maxOrderId ? orderIndex.find(orderId) : nullHandle;
+        return handle == nullHandle ? nullptr : &orders[handle];
+    }
+
+    // Give an acquired node its id, and the index key that goes with it. Only
+    // a non-numeric id is kept as text; a numeric one is its key.
+    static void assignId(Node& node, std::string_view orderId) {
+        node.key = orderKey(orderId);
+        if ((node.key & textKeyBit) != 0) {
+            node.textId.assign(orderId);
+        } else {
+            node.textId.clear();
+        }
+    }
+    static void assignId(Node& node, OrderId orderId) {
+        node.textId.clear();
+        node.key = orderId;
+    }
+    PricePolicy&       pricePolicy()       { return prices; }
+    const PricePolicy& pricePolicy() const { return prices; }
+
+    // Runs f on the concrete Sides (see BookSides)
+    template <typename F>
+    decltype(auto) visitSides(F&& f) const { return PricePolicy::visit(sides, std::forward<F>(f)); }
+
+    // Makes room for `capacity` resting orders up front
+    void reserveOrders(std::size_t capacity) {
+        orders.reserve(capacity);
+        orderIndex.reserve(capacity);
+    }
+
+    // Checks a freshly filled-in node before it enters the book, including
+    // that ladder storage could rest it if it must; frees the node and
+    // throws std::invalid_argument or std::length_error if it is rejected
+    void validate(Node& node, bool mayRest) {
+        if (node.quantity <= 0) {
+            orders.release(node);
+            throw std::invalid_argument("OrderBook: order quantity must be positive");
+        }
+        if (node.textId.size() > OrderSnapshot::maxIdLength) {
+            orders.release(node);
+            throw std::invalid_argument("OrderBook: order id too long");
+        }
+        if (findHandle(node.key, node.textId) != nullHandle) {
+            const std::string id = node.getId();
+            orders.release(node);
+            throw std::invalid_argument("OrderBook: duplicate order id " + id);
+        }
+        if (mayRest) {
+            if (!fits(node.side, node.price)) {
+                orders.release(node);
+                throw std::length_error("OrderBook: price range exceeds ladder capacity");
+            }
+        }
+    }
+
+    // links a validated node into the index and behind the orders already at
+    // its level
+    void link(Node& node) {
+        orderIndex.insert(node.key, node.handle);
+        try {
+            enqueue(node);
+        } catch (...) {
+            orderIndex.erase(node.key, node.handle);
+            orders.release(node);
+            throw;
+        }
+    }
+
+    // Whether the opposite side holds the node's whole quantity within its limit
+    bool fillable(const Node& node) const {
+        std::int64_t available = 0;
+        visitSides([&](const auto& s) {
+            auto within = [&](const auto& levels) {
+                const typename std::remove_cvref_t<decltype(levels)>::key_compare isBetter;
+                levels.forEachWhile([&](Price price, const Level& level) {
+                    if (isBetter(node.price, price)) {
+                        return false;
+                    }
+                    available += level.quantity();
+                    return available < node.quantity;
+                });
+            };
+            if (node.side == OrderType::BUY) {
+                within(s.sellOrders);
+            } else {
+                within(s.buyOrders);
+            }
+        });
+        return available >= node.quantity;
+    }
+
+    // Takes a freshly filled-in node as an incoming order, as part of the
+    // message the caller began on the clock: it matches against the
+    // opposite side first, and only a GoodTillCancel remainder is linked
+    // into the book, so a marketable order never rests and the book is
+    // never crossed. Raises ADD, the trades, and a REMOVE for an
+    // ImmediateOrCancel remainder; a FillOrKill order that cannot fill in full
+    // raises nothing. Returns the quantity filled.
+    int submit(Node& node, TimeInForce timeInForce = TimeInForce::GoodTillCancel) {
+        const std::uint64_t startedAt = stats.start();
+        validate(node, timeInForce == TimeInForce::GoodTillCancel);
+        if (timeInForce == TimeInForce::FillOrKill && !fillable(node)) {
+            orders.release(node);
+            stats.finish(BookOperation::Add, startedAt, orders.size());
+            return 0;
+        }
+
+        const int quantity = node.quantity;
+        recordOrder(OrderEventType::ADD, node);
+        sweep(node);
+        const int filled = quantity - node.quantity;
+
+        if (node.quantity > 0 && timeInForce == TimeInForce::GoodTillCancel) {
+            try {
+                link(node);
+                touchLevel(node.side, node.price);
+            } catch (...) {
+                // Only a failed allocation gets here; validate checked the rest
+                publish();
+                throw;
+            }
+        } else {
+            if (node.quantity > 0) {
+                recordOrder(OrderEventType::REMOVE, node);
+            }
+            orders.release(node);
+        }
+        publish();
+        stats.finish(BookOperation::Add, startedAt, orders.size());
+        return filled;
+    }
+
+    // Applies count orders or commands in order through apply(i), which
+    // returns false (or throws std::invalid_argument or std::length_error)
+    // for one the book refuses, then publishes everything they raised as a
+    // single block
+    template <typename Apply>
+    BatchResult runBatch(std::size_t count, Apply&& apply) {
+        BatchResult result;
+        batching = true;
+        try {
+            for (std::size_t i = 0; i < count; ++i) {
+                bool accepted = false;
+                try {
+                    accepted = apply(i);
+                } catch (const std::invalid_argument&) {
+                } catch (const std::length_error&) {
+                }
+                ++(accepted ? result.applied : result.rejected);
+            }
+        } catch (...) {
+            batching = false;
+            publish();
+            throw;
+        }
+        batching = false;
+        publish();
+        return result;
+    }
+
+    // links a node as recovered state: no events and no matching, so the
+    // caller must keep the book uncrossed
+    void restore(Node& node) {
+        validate(node, true);
+        link(node);
+        refreshTopOfBook();
+    }
+
+    // Drops every resting order without raising events or level updates,
+    // leaving the book empty, as when undoing a partial restore
+    void discardAll() {
+        std::vector<OrderHandle> handles;
+        handles.reserve(orders.size());
+        visitSides([&](const auto& s) {
+            auto collect = [&](const auto& levels) {
+                levels.forEach([&](Price, const Level& level) {
+                    level.forEach([&](const Node& node) { handles.push_back(node.handle); });
+                });
+            };
+            collect(s.buyOrders);
+            collect(s.sellOrders);
+        });
+        for (const OrderHandle handle : handles) {
+            retire(orders[handle]);
+        }
+        touchedLevels.clear();
+        refreshTopOfBook();
+    }
+
+    // Fills an incoming order against the opposite side, records the trades
+    // and frees every resting order left with nothing to fill. The incoming
+    // order's own side is not touched.
+    void sweep(Node& incoming) {
+        const std::uint64_t startedAt = stats.start();
+        fills.clear();
+        PricePolicy::visit(sides, [&](auto& s) {
+            auto record = [&](Node& resting, int qty) { fills.push_back({&resting, qty}); };
+            if (incoming.side == OrderType::BUY) {
+                MatchingEngine::sweep(incoming, s.sellOrders, record);
+            } else {
+                MatchingEngine::sweep(incoming, s.buyOrders, record);
+            }
+        });
+
+        if constexpr (statsEnabled) {
+            // Fills come best level first, so each new price is a new level
+            std::size_t levels = 0;
+            for (std::size_t i = 0; i < fills.size(); ++i) {
+                if (i == 0 || fills[i].resting->price != fills[i - 1].resting->price) ++levels;
+            }
+            if (levels > 0) stats.levelsWalked(levels);
+        }
+
+        // Record while every filled node is still valid, walking the
+        // incoming quantity back down from what it was before the sweep
+        int incomingLeft = incoming.quantity;
+        for (const auto& f : fills) incomingLeft += f.quantity;
+        for (const auto& f : fills) {
+            touchLevel(f.resting->side, f.resting->price);
+            incomingLeft -= f.quantity;
+            recordTrade(incoming, *f.resting, f.quantity, incomingLeft);
+        }
+
+        // The sweep has already unlinked every resting order it filled
+        for (const auto& f : fills) {
+            if (f.resting->quantity == 0) {
+                orderIndex.erase(f.resting->key, f.resting->handle);
+                orders.release(*f.resting);
+            }
+        }
+        stats.finish(BookOperation::Match, startedAt, orders.size());
+    }
+
+    // Matches an order already resting in the book against the opposite
+    // side, as if it had just arrived, and publishes the events. A book kept
+    // by submit is never crossed, so this only trades after the caller has
+    // restored orders that cross.
+    void match(Node& resting) {
+        clock.beginMessage();
+        const int quantity = resting.quantity;
+        sweep(resting);
+        if (resting.quantity != quantity) {
+            findLevel(resting.side, resting.price)->reduce(quantity - resting.quantity);
+            touchLevel(resting.side, resting.price);
+        }
+        if (resting.quantity == 0) {
+            retire(resting);
+        }
+        publish();
+    }
+
+public:
+    // Prices in orders are already in ticks; the scale records the instrument's
+    // tick size for callers converting to and from decimal prices.
+    // orderCapacity resting orders fit before the book allocates more storage.
+    explicit BasicOrderBook(PriceScale priceScale = PriceScale{},
+                            PricePolicy prices = PricePolicy{},
+                            std::size_t orderCapacity = OrderPool<Node>::defaultCapacity)
+        : prices(std::move(prices)), sides(this->prices.template makeSides<Level>()),
+          orders(orderCapacity), orderIndex(orderCapacity), priceScale(priceScale) {}
+
+    // Same as above, with observers that are not default-constructed
+    BasicOrderBook(PriceScale priceScale, PricePolicy prices, std::size_t orderCapacity,
+                   Observers... observers) requires (sizeof...(Observers) > 0)
+        : prices(std::move(prices)), sides(this->prices.template makeSides<Level>()),
+          orders(orderCapacity), orderIndex(orderCapacity),
+          observers(std::move(observers)...), priceScale(priceScale) {}
+
+    BasicOrderBook(const BasicOrderBook&) = delete;
+    BasicOrderBook& operator=(const BasicOrderBook&) = delete;
+
+    // Adds an order that lives only in the book's pool. It trades first and,
+    // under GoodTillCancel, rests what is left (see submit); returns the
+    // quantity filled. Once the pool and index are warm, adding, matching and
+    // cancelling orders does not allocate unless an observer does. Throws
+    // std::invalid_argument for a non-positive quantity, or an id that is
+    // already resting or longer than OrderSnapshot::maxIdLength, and
+    // std::length_error if ladder storage cannot fit a price that may rest.
+    int addOrder(std::string_view orderId, OrderType type, Price price, int quantity,
+                 TimeInForce timeInForce = TimeInForce::GoodTillCancel) {
+        clock.beginMessage();
+        Node& node = orders.acquire();
+        assignId(node, orderId);
+        node.price     = price;
+        node.quantity  = quantity;
+        node.side      = type;
+        node.timestamp = clock.stamp();
+        return submit(node, timeInForce);
+    }
+
+    // The same by numeric id, which must be at most maxOrderId (otherwise
+    // std::invalid_argument). Order 42 and order "42" are the same order.
+    int addOrder(OrderId orderId, OrderType type, Price price, int quantity,
+                 TimeInForce timeInForce = TimeInForce::GoodTillCancel) {
+        if (orderId > maxOrderId) {
+            throw std::invalid_argument("OrderBook: order id out of range");
+        }
+        clock.beginMessage();
+        Node& node = orders.acquire();
+        assignId(node, orderId);
+        node.price     = price;
+        node.quantity  = quantity;
+        node.side      = type;
+        node.timestamp = clock.stamp();
+        return submit(node, timeInForce);
+    }
+
+    // Applies adds, cancels and modifies exactly as addOrder, cancel and
+    // modify would, one after the other, but hands observers the events (and level updates) of the
+    // whole batch as one block at the end. Commands the book refuses are
+    // skipped and counted; the rest of the batch still applies.
+    BatchResult applyBatch(std::span<const OrderCommand> commands) {
+        return runBatch(commands.size(), [&](std::size_t i) { return applyCommand(*this, commands[i]); });
+    }
+
+    // Cancels a resting order in O(1): an index lookup and an unlink from its
+    // level. Returns false (and notifies nobody) if no such order is resting.
+    bool cancel(std::string_view orderId) {
+        const std::uint64_t startedAt = stats.start();
+        clock.beginMessage();
+        return cancelNode(findNode(orderId), startedAt);
+    }
+    bool cancel(OrderId orderId) {
+        const std::uint64_t startedAt = stats.start();
+        clock.beginMessage();
+        return cancelNode(findNode(orderId), startedAt);
+    }
+
+    // Amends a resting order. Lowering only its quantity keeps its place in
+    // the queue: the order and its level shrink in place. A new price or a
+    // larger quantity moves it instead, as a cancel and re-add would: it
+    // leaves its level, trades if the new price crosses, and rests what is
+    // left behind the orders already at that price. Either way observers see
+    // a single MODIFY (followed by any trades); a modify that changes nothing
+    // raises nothing. Returns false (and notifies nobody) if no such order is
+    // resting. Throws std::invalid_argument for a non-positive quantity and
+    // std::length_error if ladder storage cannot fit the new price; the order
+    // is then left as it was.
+    bool modify(std::string_view orderId, int quantity, Price price) {
+        const std::uint64_t startedAt = stats.start();
+        clock.beginMessage();
+        return modifyNode(findNode(orderId), quantity, price, startedAt);
+    }
+    bool modify(OrderId orderId, int quantity, Price price) {
+        const std::uint64_t startedAt = stats.start();
+        clock.beginMessage();
+        return modifyNode(findNode(orderId), quantity, price, startedAt);
+    }
+
+    // The resting order with this id, or nullptr; valid until the book is
+    // next modified
+    const Node* find(std::string_view orderId) const {
+        const OrderHandle handle = findHandle(orderKey(orderId), orderId);
+        return handle == nullHandle ? nullptr : &orders[handle];
+    }
+    const Node* find(OrderId orderId) const {
+        const OrderHandle handle = orderId <= maxOrderId ? orderIndex.find(orderId) : nullHandle;
+        return handle == nullHandle ? nullptr : &orders[handle];
+    }
+
+    // Visits the levels of a side best first, as visit(LevelView<Node>),
+    // within range; a visitor that returns bool stops the walk by returning
+    // false. Nothing is copied: each view reads the level in place (see the
+    // invalidation rules above).
+    template <typename Visitor>
+    void forEachLevel(OrderType side, Visitor&& visit, const LevelRange& range = LevelRange{}) const {
+        if (range.depth == 0) {
+            return;
+        }
+        std::size_t visited = 0;
+        visitSides([&](const auto& s) {
+            auto walk = [&](const auto& levels) {
+                const typename std::remove_cvref_t<decltype(levels)>::key_compare isBetter;
+                levels.forEachWhile([&](Price price, const Level& level) {
+                    if (range.through && isBetter(*range.through, price)) {
+                        return false;
+                    }
+                    const LevelView<Node> view{price, level};
+                    if constexpr (std::is_same_v<std::invoke_result_t<Visitor&, const LevelView<Node>&>, bool>) {
+                        if (!visit(view)) return false;
+                    } else {
+                        visit(view);
+                    }
+                    return ++visited < range.depth;
+                });
+            };
+            if (side == OrderType::BUY) {
+                walk(s.buyOrders);
+            } else {
+                walk(s.sellOrders);
+            }
+        });
+    }
+
+    // Writes the best out.size() levels of a side (fewer if it has fewer),
+    // best first, and returns how many were written. Reads only each level's
+    // totals, so the cost is O(levels written), not O(orders).
+    std::size_t getDepth(OrderType side, std::span<DepthLevel> out) const {
+        std::size_t written = 0;
+        forEachLevel(side, [&](const LevelView<Node>& level) {
+            out[written++] = DepthLevel{level.price(), level.quantity(), static_cast<std::uint32_t>(level.orderCount())};
+        }, LevelRange{out.size(), std::nullopt});
+        return written;
+    }
+
+    // Best bid and offer as of the last completed operation; O(1). Only on
+    // the thread that operates the book.
+    const TopOfBook&  getTopOfBook() const { return top; }
+    const DepthLevel& getBestBid()   const { return top.bid; }
+    const DepthLevel& getBestAsk()   const { return top.ask; }
+
+    // The same from any thread, without locking the book: a consistent copy
+    // as of some completed operation, possibly a little behind.
+    TopOfBook loadTopOfBook() const { return publishedTop.load(); }
+
+    // The observer of type Observer held by this book
+    template <typename Observer>
+    Observer&       observer()       { return std::get<Observer>(observers); }
+    template <typename Observer>
+    const Observer& observer() const { return std::get<Observer>(observers); }
+
+    // Tells the observers that have an onIdle that the book has nothing to do
+    // for now, so those that buffer can write out what is due. EngineRunner
+    // calls it whenever its queue is empty. Raises no events.
+    void idle() {
+        std::apply([](auto&... observer) {
+            auto notify = [](auto& o) {
+                if constexpr (requires { o.onIdle(); }) {
+                    o.onIdle();
+                }
+            };
+            (notify(observer), ...);
+        }, observers);
+    }
+
+    // Latency and shape statistics of this book; may be read from any
+    // thread. Empty (enabled == false) when built with ORDERBOOK_STATS=0.
+    BookStatsSnapshot getStats() const { return stats.snapshot(); }
+
+    // The clock orders and events are stamped with. Replace it between
+    // operations, e.g. with a Simulated one to make timestamps reproducible.
+    EngineClock&       getClock()       { return clock; }
+    const EngineClock& getClock() const { return clock; }
+    void setClock(const EngineClock& replacement) { clock = replacement; }
+
+    // Sequence number of the last event this book raised; 0 before any
+    std::uint64_t     getSequence()   const { return eventSequence; }
+    const PriceScale& getPriceScale() const { return priceScale; }
+    std::size_t       getOrderCount() const { return orders.size(); }
+};
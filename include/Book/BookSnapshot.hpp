@@ -0,0 +1,69 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#include "Price.hpp"
+
+// Binary book snapshot layout (see OrderBook::saveSnapshot).
+//
+// A SnapshotHeader, a SnapshotJournal, then levelCount SnapshotLevels,
+// orderCount SnapshotOrders and internedCount SnapshotInternedIds. Levels run
+// in priority order, the sell side (lowest price first) before the buy side
+// (highest price first); the orders of each level follow in the same
+// sequence, in time priority, one level after another. All records have a
+// fixed size, so the file can be mapped and read in place. Fields are stored
+// in the writer's native byte order.
+//
+// Version 1 files have no SnapshotJournal and no interned ids; they are
+// still read, as checkpoints without a journal offset.
+
+inline constexpr char          snapshotMagic[8] = {'O', 'B', 'S', 'N', 'A', 'P', '\0', '\0'};
+inline constexpr std::uint16_t snapshotVersion  = 2;
+
+struct SnapshotHeader {
+	char          magic[8];
+	std::uint16_t version;
+	std::uint16_t reserved[3];
+	std::uint64_t journalSequence;   // last journalled event the book reflects
+	std::uint64_t levelCount;
+	std::uint64_t orderCount;
+	double        tickSize;
+};
+
+// The rest of the JournalCheckpoint the snapshot was taken at (the sequence
+// is in the header)
+struct SnapshotJournal {
+	std::uint64_t offset;            // journal bytes the book reflects; 0 if unknown
+	std::uint64_t nextInterned;
+	std::uint64_t nextOrderId;
+	std::uint64_t internedCount;
+};
+
+struct SnapshotLevel {
+	Price         price;
+	std::uint32_t orderCount;
+	std::uint8_t  side;              // OrderType
+	std::uint8_t  reserved[3];
+};
+
+struct SnapshotOrder {
+	std::int64_t  timestampNs;       // system_clock, since the epoch
+	std::int32_t  quantity;
+	std::uint8_t  idLength;
+	std::uint8_t  reserved[3];
+	char          id[32];
+};
+
+// An interned journal id the tail after the snapshot may use
+struct SnapshotInternedId {
+	std::uint64_t orderId;           // with internedIdBit
+	std::uint8_t  idLength;
+	std::uint8_t  reserved[7];
+	char          id[32];
+};
+
+static_assert(sizeof(SnapshotHeader) == 48 && std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(sizeof(SnapshotLevel) == 16 && std::is_trivially_copyable_v<SnapshotLevel>);
+static_assert(sizeof(SnapshotOrder) == 48 && std::is_trivially_copyable_v<SnapshotOrder>);
+static_assert(sizeof(SnapshotJournal) == 32 && std::is_trivially_copyable_v<SnapshotJournal>);
+static_assert(sizeof(SnapshotInternedId) == 48 && std::is_trivially_copyable_v<SnapshotInternedId>);
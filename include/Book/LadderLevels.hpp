@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "Price.hpp"
+
+// Default window of a ladder side: the slots it starts with and the most it
+// may grow to
+inline constexpr std::size_t ladderInitialSlots = 1024;
+inline constexpr std::size_t ladderMaxSlots     = std::size_t{1} << 20;
+
+// Price levels stored in a dense, tick-indexed array: slot i holds the level at
+// price base + i. Lookups are a subtraction and an index, and walking levels
+// while matching is a linear scan through contiguous memory.
+//
+// The window is centred on the touch (this side's best price). When a price
+// arrives outside it, the ladder re-centres around the touch and grows as
+// needed so that every live level still fits. A side whose live levels span
+// more than maxSlots ticks cannot be represented and is rejected with
+// std::length_error.
+template <typename Level, typename Compare>
+class LadderLevels {
+public:
+    using key_compare = Compare;
+
+    static constexpr std::size_t defaultInitialSlots = ladderInitialSlots;
+    static constexpr std::size_t defaultMaxSlots     = ladderMaxSlots;
+
+private:
+    // Direction of worse prices in index space: up for asks, down for bids
+    static constexpr std::ptrdiff_t worseStep = Compare{}(Price{0}, Price{1}) ? 1 : -1;
+
+    std::vector<std::optional<Level>> slots;
+    Price       base       = 0;   // price of slots[0]
+    std::size_t best       = 0;   // index of the best level, valid when levelCount > 0
+    std::size_t levelCount = 0;
+    std::size_t maxSlots;
+
+    bool contains(Price price) const {
+        return price >= base && price - base < static_cast<Price>(slots.size());
+    }
+    std::size_t indexOf(Price price) const { return static_cast<std::size_t>(price - base); }
+
+    // After the best level empties, the next best is the first live slot in
+    // the worse direction.
+    void advanceBest() {
+        auto i = static_cast<std::ptrdiff_t>(best);
+        while (!slots[static_cast<std::size_t>(i)]) {
+            i += worseStep;
+        }
+        best = static_cast<std::size_t>(i);
+    }
+
+    void recentre(Price price) {
+        Price low  = price;
+        Price high = price;
+        Price touch = price;
+        if (levelCount > 0) {
+            std::size_t first = 0;
+            while (!slots[first]) ++first;
+            std::size_t last = slots.size() - 1;
+            while (!slots[last]) --last;
+
+            low   = std::min(low,  base + static_cast<Price>(first));
+            high  = std::max(high, base + static_cast<Price>(last));
+            touch = Compare{}(price, bestPrice()) ? price : bestPrice();
+        }
+
+        const auto span = static_cast<std::size_t>(high - low) + 1;
+        if (span > maxSlots) {
+            throw std::length_error("LadderLevels: price range exceeds ladder capacity");
+        }
+
+        // Leave as much room again as the live range needs, so a drifting
+        // touch does not re-centre on every new level
+        std::size_t capacity = slots.size();
+        while (capacity < 2 * span && capacity < maxSlots) {
+            capacity *= 2;
+        }
+        capacity = std::min(capacity, maxSlots);
+
+        Price newBase = touch - static_cast<Price>(capacity / 2);
+        newBase = std::min(newBase, low);
+        newBase = std::max(newBase, high - static_cast<Price>(capacity) + 1);
+
+        std::vector<std::optional<Level>> moved(capacity);
+        for (std::size_t i = 0; i < slots.size(); ++i) {
+            if (slots[i]) {
+                moved[static_cast<std::size_t>(base + static_cast<Price>(i) - newBase)] = std::move(slots[i]);
+            }
+        }
+        if (levelCount > 0) {
+            best = static_cast<std::size_t>(bestPrice() - newBase);
+        }
+        slots = std::move(moved);
+        base  = newBase;
+    }
+
+public:
+    explicit LadderLevels(std::size_t initialSlots = defaultInitialSlots,
+                          std::size_t maxSlots     = defaultMaxSlots)
+        : slots(std::max<std::size_t>(initialSlots, 1)), maxSlots(std::max(maxSlots, initialSlots)) {}
+
+    bool        empty() const { return levelCount == 0; }
+    std::size_t size()  const { return levelCount; }
+
+    // Number of slots in the current window
+    std::size_t capacity() const { return slots.size(); }
+
+    Level* find(Price price) {
+        if (!contains(price)) return nullptr;
+        auto& slot = slots[indexOf(price)];
+        return slot ? &*slot : nullptr;
+    }
+
+    Level& getOrCreate(Price price) {
+        if (!contains(price)) {
+            recentre(price);
+        }
+
+        const std::size_t i = indexOf(price);
+        auto& slot = slots[i];
+        if (!slot) {
+            slot.emplace();
+            if (levelCount == 0 || Compare{}(price, bestPrice())) {
+                best = i;
+            }
+            ++levelCount;
+        }
+        return *slot;
+    }
+
+    // Whether getOrCreate(price) would succeed rather than throw
+    // std::length_error
+    bool fits(Price price) const {
+        if (contains(price) || levelCount == 0) return true;
+
+        std::size_t first = 0;
+        while (!slots[first]) ++first;
+        std::size_t last = slots.size() - 1;
+        while (!slots[last]) --last;
+        const Price low  = std::min(price, base + static_cast<Price>(first));
+        const Price high = std::max(price, base + static_cast<Price>(last));
+        return static_cast<std::size_t>(high - low) + 1 <= maxSlots;
+    }
+
+    void erase(Price price) {
+        if (!contains(price)) return;
+
+        const std::size_t i = indexOf(price);
+        if (!slots[i]) return;
+
+        slots[i].reset();
+        --levelCount;
+        if (levelCount > 0 && i == best) {
+            advanceBest();
+        }
+    }
+
+    // Best level accessors; the side must not be empty
+    Price  bestPrice() const { return base + static_cast<Price>(best); }
+    Level& bestLevel()       { return *slots[best]; }
+    void   eraseBest()       { erase(bestPrice()); }
+
+    // Visits every level best-first as visit(price, level)
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        forEachWhile([&](Price price, const Level& level) {
+            visit(price, level);
+            return true;
+        });
+    }
+
+    // Same, stopping as soon as visit returns false. Empty slots between
+    // levels are skipped, so reaching the n-th level also costs its distance
+    // in ticks from the touch.
+    template <typename Visitor>
+    void forEachWhile(Visitor&& visit) const {
+        if (levelCount == 0) return;
+
+        std::size_t remaining = levelCount;
+        for (auto i = static_cast<std::ptrdiff_t>(best); remaining > 0; i += worseStep) {
+            const auto& slot = slots[static_cast<std::size_t>(i)];
+            if (slot) {
+                if (!visit(base + static_cast<Price>(i), *slot)) return;
+                --remaining;
+            }
+        }
+    }
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+
+#include "Price.hpp"
+#include "Book/PriceLevel.hpp"
+
+// How far a walk over one side of a book goes from the touch: at most depth
+// levels, and none worse than through (when set)
+struct LevelRange {
+    std::size_t          depth = std::numeric_limits<std::size_t>::max();
+    std::optional<Price> through;
+};
+
+// Non-owning view of one price level of a book: its price, totals and the
+// resting orders in time priority (range-for over const Node&). Like any
+// reference into the book it is only valid until the book is next modified.
+template <typename Node>
+class LevelView {
+private:
+    Price                   levelPrice;
+    const PriceLevel<Node>* level;
+
+public:
+    LevelView(Price price, const PriceLevel<Node>& level) : levelPrice(price), level(&level) {}
+
+    Price         price()      const { return levelPrice; }
+    std::int64_t  quantity()   const { return level->quantity(); }
+    std::size_t   orderCount() const { return level->size(); }
+
+    const Node& front() const { return level->front(); }
+    auto begin() const { return level->begin(); }
+    auto end()   const { return level->end(); }
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "Price.hpp"
+
+// Price levels kept in a red-black tree ordered best-first by Compare
+// (std::greater<> for bids, std::less<> for asks). Any price can be stored,
+// at O(log n) per lookup.
+//
+// Tree nodes of erased levels are kept and reused for new levels, so a side
+// whose level count stays within what it has seen before does not allocate.
+template <typename Level, typename Compare>
+class MapLevels {
+public:
+    using key_compare = Compare;
+    using Map = std::map<Price, Level, Compare>;
+
+    static constexpr std::size_t maxSpareLevels = 1024;
+
+private:
+    Map                                    levels;
+    std::vector<typename Map::node_type>   spareNodes;
+
+    void recycle(typename Map::iterator it) {
+        if (spareNodes.size() < maxSpareLevels) {
+            auto& node = spareNodes.emplace_back(levels.extract(it));
+            node.mapped().clear();
+        } else {
+            levels.erase(it);
+        }
+    }
+
+public:
+    MapLevels() = default;
+    explicit MapLevels(Map levels) : levels(std::move(levels)) {}
+
+    bool        empty() const { return levels.empty(); }
+    std::size_t size()  const { return levels.size(); }
+
+    Level* find(Price price) {
+        auto it = levels.find(price);
+        return it == levels.end() ? nullptr : &it->second;
+    }
+
+    Level& getOrCreate(Price price) {
+        auto it = levels.lower_bound(price);
+        if (it != levels.end() && !levels.key_comp()(price, it->first)) {
+            return it->second;
+        }
+        if (spareNodes.empty()) {
+            return levels.emplace_hint(it, price, Level{})->second;
+        }
+
+        auto node = std::move(spareNodes.back());
+        spareNodes.pop_back();
+        node.key() = price;
+        return levels.insert(it, std::move(node))->second;
+    }
+
+    // Any price can be stored
+    bool fits(Price) const { return true; }
+
+    void erase(Price price) {
+        auto it = levels.find(price);
+        if (it != levels.end()) {
+            recycle(it);
+        }
+    }
+
+    // Best level accessors; the side must not be empty
+    Price  bestPrice() const { return levels.begin()->first; }
+    Level& bestLevel()       { return levels.begin()->second; }
+    void   eraseBest()       { recycle(levels.begin()); }
+
+    // Visits every level best-first as visit(price, level)
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const auto& [price, level] : levels) {
+            visit(price, level);
+        }
+    }
+
+    // Same, stopping as soon as visit returns false
+    template <typename Visitor>
+    void forEachWhile(Visitor&& visit) const {
+        for (const auto& [price, level] : levels) {
+            if (!visit(price, level)) return;
+        }
+    }
+
+    Map release() && { return std::move(levels); }
+};
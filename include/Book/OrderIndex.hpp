@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "OrderId.hpp"
+#include "Book/OrderNode.hpp"
+
+// Maps order keys to their OrderPool handles: an open-addressing table with
+// linear probing over one flat array of (key, handle) slots, kept at most
+// half full. A lookup is a hash and a short scan of adjacent slots, with no
+// string in sight; lookups of hashed text keys confirm each candidate through
+// `matches`, since two texts may share a key. Erasing shifts the rest of the
+// probe run back rather than leaving tombstones, so runs stay short under
+// churn, and an index sized for its peak never allocates.
+class OrderIndex {
+private:
+    struct Slot {
+        OrderId     key    = 0;
+        OrderHandle handle = nullHandle;   // nullHandle marks an empty slot
+    };
+
+    static constexpr std::size_t minSlots = 16;
+
+    std::vector<Slot> slots;
+    std::size_t       count = 0;
+    std::size_t       mask  = 0;
+
+    // Numeric ids are mostly sequential; spread them over the table
+    static std::size_t hash(OrderId key) {
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdULL;
+        key ^= key >> 33;
+        return static_cast<std::size_t>(key);
+    }
+
+    std::size_t home(OrderId key) const { return hash(key) & mask; }
+
+    void place(const Slot& slot) {
+        std::size_t i = home(slot.key);
+        while (slots[i].handle != nullHandle) {
+            i = (i + 1) & mask;
+        }
+        slots[i] = slot;
+    }
+
+    void rehash(std::size_t slotCount) {
+        std::vector<Slot> old = std::exchange(slots, std::vector<Slot>(slotCount));
+        mask = slotCount - 1;
+        for (const Slot& slot : old) {
+            if (slot.handle != nullHandle) place(slot);
+        }
+    }
+
+public:
+    explicit OrderIndex(std::size_t capacity = 0) { reserve(capacity); }
+
+    // Makes room for `capacity` entries without growing
+    void reserve(std::size_t capacity) {
+        std::size_t slotCount = minSlots;
+        while (slotCount < 2 * capacity) {
+            slotCount *= 2;
+        }
+        if (slotCount > slots.size()) {
+            rehash(slotCount);
+        }
+    }
+
+    // The handle of an entry with this key for which matches(handle) holds,
+    // or nullHandle
+    template <typename Matches>
+    OrderHandle find(OrderId key, Matches&& matches) const {
+        if (count == 0) {
+            return nullHandle;
+        }
+        for (std::size_t i = home(key); slots[i].handle != nullHandle; i = (i + 1) & mask) {
+            if (slots[i].key == key && matches(slots[i].handle)) {
+                return slots[i].handle;
+            }
+        }
+        return nullHandle;
+    }
+
+    OrderHandle find(OrderId key) const {
+        return find(key, [](OrderHandle) { return true; });
+    }
+
+    // The caller has checked that the order is not already present
+    void insert(OrderId key, OrderHandle handle) {
+        if (2 * (count + 1) > slots.size()) {
+            rehash(std::max(minSlots, 2 * slots.size()));
+        }
+        place(Slot{key, handle});
+        ++count;
+    }
+
+    void erase(OrderId key, OrderHandle handle) {
+        if (count == 0) {
+            return;
+        }
+        std::size_t hole = home(key);
+        while (!(slots[hole].key == key && slots[hole].handle == handle)) {
+            if (slots[hole].handle == nullHandle) {
+                return;
+            }
+            hole = (hole + 1) & mask;
+        }
+
+        // Pull back every later entry of the run that may sit in the hole:
+        // one whose home is not cyclically within (hole, i]
+        for (std::size_t i = (hole + 1) & mask; slots[i].handle != nullHandle; i = (i + 1) & mask) {
+            const std::size_t h = home(slots[i].key);
+            const bool stays = hole < i ? (hole < h && h <= i) : (hole < h || h <= i);
+            if (!stays) {
+                slots[hole] = slots[i];
+                hole = i;
+            }
+        }
+        slots[hole].handle = nullHandle;
+        --count;
+    }
+
+    std::size_t size() const { return count; }
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "OrderId.hpp"
+#include "Price.hpp"
+#include "Interfaces/IOrder.hpp"
+
+// Compact reference to an order slot in an OrderPool
+using OrderHandle = std::uint32_t;
+inline constexpr OrderHandle nullHandle = UINT32_MAX;
+
+// The fields of a resting order as the book stores it. An order policy's Node
+// type derives from this (passing itself as Node), adding whatever else it
+// needs. Nodes live in the book's OrderPool and are linked into the FIFO of
+// their price level, so an order can be unlinked from anywhere in its level
+// without searching for it.
+template <typename Node>
+struct BasicOrderNode {
+    std::string                           textId;         // a non-numeric id; empty for a numeric one (see getId)
+    OrderId                               key      = 0;   // the id's OrderIndex key (see orderKey)
+    Price                                 price    = 0;
+    int                                   quantity = 0;
+    OrderType                             side     = OrderType::BUY;
+    std::chrono::system_clock::time_point timestamp;
+
+    OrderHandle                           handle   = nullHandle;
+    Node*                                 prev     = nullptr;
+    Node*                                 next     = nullptr;
+
+    // The id as text. A numeric id is kept only as its key, and formatted
+    // into `digits` here, when something outside the book asks for it.
+    std::string_view getId(char (&digits)[maxOrderIdDigits]) const {
+        if ((key & textKeyBit) != 0) {
+            return textId;
+        }
+        return std::string_view(digits, formatOrderId(key, digits));
+    }
+    std::string getId() const {
+        char digits[maxOrderIdDigits];
+        return std::string(getId(digits));
+    }
+
+    // Hooks a Node type may hide with its own versions; called on fills (and
+    // in-place quantity reductions), when an order is moved to a new price or
+    // quantity, and when the node goes back to the pool
+    void reduceQuantity(int amount) { quantity -= amount; }
+    void amend(Price newPrice, int newQuantity) {
+        price    = newPrice;
+        quantity = newQuantity;
+    }
+    void onRelease() {}
+};
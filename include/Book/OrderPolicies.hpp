@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+
+#include "Book/OrderNode.hpp"
+#include "Interfaces/IOrder.hpp"
+
+// Order policies pick the node type a BasicOrderBook stores its orders in.
+
+// Orders that exist only inside the book. Nothing outside has to be kept in
+// step, so a fill is a single subtraction.
+struct PooledOrders {
+    struct Node : BasicOrderNode<Node> {};
+};
+
+// Orders that may also be held by callers as IOrder objects (OrderBook's
+// policy). Fills are mirrored into the caller's order so its holders see the
+// remaining quantity; orders added without one behave like PooledOrders.
+struct SharedOrders {
+    struct Node : BasicOrderNode<Node> {
+        std::shared_ptr<IOrder> origin;
+
+        void reduceQuantity(int amount) {
+            quantity -= amount;
+            if (origin) origin->reduceQuantity(amount);
+        }
+        // An IOrder can only shrink, so once the order moves to another
+        // price or quantity the book keeps it on its own
+        void amend(Price newPrice, int newQuantity) {
+            BasicOrderNode<Node>::amend(newPrice, newQuantity);
+            origin.reset();
+        }
+        // Drop the reference to the caller's order now rather than on reuse
+        void onRelease() { origin.reset(); }
+    };
+};
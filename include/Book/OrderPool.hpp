@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "Book/OrderNode.hpp"
+
+// Slab allocator for the book's order nodes. Nodes live in fixed-size slabs of
+// contiguous storage and are addressed by OrderHandle (slab, slot). Released
+// nodes go onto a free list and are handed out again before any new slab is
+// allocated, so a book that stays within its capacity never allocates.
+// Slabs are never moved, so node addresses stay valid until released.
+template <typename Node>
+class OrderPool {
+public:
+    static constexpr std::size_t slabShift       = 12;
+    static constexpr std::size_t slabSize        = std::size_t{1} << slabShift;
+    static constexpr std::size_t defaultCapacity = slabSize;
+
+private:
+    std::vector<std::unique_ptr<Node[]>>   slabs;
+    Node*                                  freeList = nullptr;   // linked through Node::next
+    std::size_t                            live     = 0;
+
+    void addSlab() {
+        const std::size_t first = slabs.size() * slabSize;
+        if (first + slabSize > nullHandle) {
+            throw std::length_error("OrderPool: out of order handles");
+        }
+
+        auto& slab = slabs.emplace_back(std::make_unique<Node[]>(slabSize));
+        // Thread the new slots onto the free list in ascending order
+        for (std::size_t i = slabSize; i-- > 0;) {
+            slab[i].handle = static_cast<OrderHandle>(first + i);
+            slab[i].next   = freeList;
+            freeList       = &slab[i];
+        }
+    }
+
+public:
+    explicit OrderPool(std::size_t capacity = defaultCapacity) {
+        reserve(capacity);
+    }
+
+    OrderPool(const OrderPool&) = delete;
+    OrderPool& operator=(const OrderPool&) = delete;
+
+    // Preallocates slabs until at least `capacity` orders fit
+    void reserve(std::size_t capacity) {
+        while (slabs.size() * slabSize < capacity) {
+            addSlab();
+        }
+    }
+
+    // Takes a free node; its fields are left for the caller to assign
+    Node& acquire() {
+        if (freeList == nullptr) {
+            addSlab();
+        }
+        Node& node = *freeList;
+        freeList  = node.next;
+        node.prev = node.next = nullptr;
+        ++live;
+        return node;
+    }
+
+    void release(Node& node) {
+        node.onRelease();
+        node.prev = nullptr;
+        node.next = freeList;
+        freeList  = &node;
+        --live;
+    }
+
+    Node&       operator[](OrderHandle handle)       { return slabs[handle >> slabShift][handle & (slabSize - 1)]; }
+    const Node& operator[](OrderHandle handle) const { return slabs[handle >> slabShift][handle & (slabSize - 1)]; }
+
+    std::size_t size()     const { return live; }
+    std::size_t capacity() const { return slabs.size() * slabSize; }
+};
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+
+#include "Interfaces/IOrder.hpp"
+
+// FIFO of resting orders at a single price level (time priority)
+using OrderQueue = std::deque<std::shared_ptr<IOrder>>;
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+// Intrusive doubly-linked FIFO of the orders resting at one price (time
+// priority). The level never owns its nodes; it only links them through
+// their prev/next pointers.
+//
+// The level also keeps the total remaining quantity of its orders, so depth
+// queries never walk them. Quantities of linked orders must change through
+// fill() (or be adjusted with reduce()) to keep the total right.
+template <typename Node>
+class PriceLevel {
+private:
+    Node*         head  = nullptr;
+    Node*         tail  = nullptr;
+    std::size_t   count = 0;
+    std::int64_t  total = 0;
+
+public:
+    // Walks the orders front to back
+    class const_iterator {
+    private:
+        const Node* node = nullptr;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = Node;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Node*;
+        using reference         = const Node&;
+
+        const_iterator() = default;
+        explicit const_iterator(const Node* node) : node(node) {}
+
+        reference operator*()  const { return *node; }
+        pointer   operator->() const { return node; }
+        const_iterator& operator++() { node = node->next; return *this; }
+        const_iterator  operator++(int) { const_iterator was = *this; ++*this; return was; }
+        bool operator==(const const_iterator&) const = default;
+    };
+
+    const_iterator begin() const { return const_iterator{head}; }
+    const_iterator end()   const { return const_iterator{}; }
+
+    bool          empty()    const { return head == nullptr; }
+    std::size_t   size()     const { return count; }
+    std::int64_t  quantity() const { return total; }
+
+    Node& front() const { return *head; }
+
+    void push_back(Node& node) {
+        node.prev = tail;
+        node.next = nullptr;
+        if (tail) {
+            tail->next = &node;
+        } else {
+            head = &node;
+        }
+        tail = &node;
+        ++count;
+        total += node.quantity;
+    }
+
+    void pop_front() { erase(*head); }
+
+    // Fills amount of a linked order
+    void fill(Node& node, int amount) {
+        node.reduceQuantity(amount);
+        total -= amount;
+    }
+
+    // Accounts for amount taken off a linked order behind the level's back
+    void reduce(int amount) { total -= amount; }
+
+    // Forgets every linked order without touching the nodes
+    void clear() {
+        head = tail = nullptr;
+        count = 0;
+        total = 0;
+    }
+
+    void erase(Node& node) {
+        if (node.prev) {
+            node.prev->next = node.next;
+        } else {
+            head = node.next;
+        }
+        if (node.next) {
+            node.next->prev = node.prev;
+        } else {
+            tail = node.prev;
+        }
+        node.prev = node.next = nullptr;
+        --count;
+        total -= node.quantity;
+    }
+
+    // Visits the orders front to back as visit(node)
+    template <typename Visitor>
+    void forEach(Visitor&& visit) const {
+        for (const Node* node = head; node != nullptr; node = node->next) {
+            visit(*node);
+        }
+    }
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <variant>
+
+#include "Book/MapLevels.hpp"
+#include "Book/LadderLevels.hpp"
+
+// Price policies pick how a BasicOrderBook stores its price levels. A policy
+// object is passed to the book's constructor and doubles as the storage's
+// configuration; the book keeps one Sides value built by makeSides() and
+// reaches it through visit(), so every operation runs against the concrete
+// level storage.
+
+// How OrderBook stores its price levels
+enum class BookStorage {
+    Map,     // std::map per side: any price, O(log n) level lookup
+    Ladder   // dense tick-indexed array per side: O(1) level lookup near the touch
+};
+
+// two different level orders: ascending for sell, descending for buy
+template <template <typename, typename> class Levels, typename Level>
+struct BookSides {
+    Levels<Level, std::less<>>      sellOrders;
+    Levels<Level, std::greater<>>   buyOrders;
+};
+
+// std::map per side, fixed at compile time
+struct MapPrices {
+    template <typename Level>
+    using Sides = BookSides<MapLevels, Level>;
+
+    template <typename Level>
+    Sides<Level> makeSides() const { return {}; }
+
+    template <typename S, typename F>
+    static decltype(auto) visit(S& sides, F&& f) { return std::forward<F>(f)(sides); }
+};
+
+// Dense tick ladder per side, fixed at compile time
+struct LadderPrices {
+    std::size_t initialSlots = ladderInitialSlots;
+    std::size_t maxSlots     = ladderMaxSlots;
+
+    template <typename Level>
+    using Sides = BookSides<LadderLevels, Level>;
+
+    template <typename Level>
+    Sides<Level> makeSides() const {
+        return {LadderLevels<Level, std::less<>>(initialSlots, maxSlots),
+                LadderLevels<Level, std::greater<>>(initialSlots, maxSlots)};
+    }
+
+    template <typename S, typename F>
+    static decltype(auto) visit(S& sides, F&& f) { return std::forward<F>(f)(sides); }
+};
+
+// Either of the above, picked at construction. Each operation dispatches on
+// the storage once, not per level or per order.
+struct RuntimePrices {
+    BookStorage  storage = BookStorage::Map;
+    LadderPrices ladder;   // used when storage is Ladder
+
+    template <typename Level>
+    using Sides = std::variant<MapPrices::Sides<Level>, LadderPrices::Sides<Level>>;
+
+    template <typename Level>
+    Sides<Level> makeSides() const {
+        if (storage == BookStorage::Ladder) {
+            return Sides<Level>(std::in_place_index<1>, ladder.makeSides<Level>());
+        }
+        return Sides<Level>(std::in_place_index<0>);
+    }
+
+    template <typename S, typename F>
+    static decltype(auto) visit(S& sides, F&& f) { return std::visit(std::forward<F>(f), sides); }
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <type_traits>
+
+#include "Price.hpp"
+#include "Events/LevelUpdate.hpp"
+
+// Best bid and best offer: the best level of each side, with an orderCount
+// (and quantity) of 0 for a side that is empty
+struct TopOfBook {
+    DepthLevel bid{};
+    DepthLevel ask{};
+
+    bool hasBid() const { return bid.orderCount > 0; }
+    bool hasAsk() const { return ask.orderCount > 0; }
+
+    // Ask minus bid in ticks; only meaningful while both sides have orders
+    Price spread() const { return ask.price - bid.price; }
+
+    bool operator==(const TopOfBook&) const = default;
+};
+
+static_assert(std::is_trivially_copyable_v<TopOfBook>);
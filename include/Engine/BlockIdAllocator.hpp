@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Hands out unique 64-bit ids from one process-wide counter without threads
+// contending on it: each thread takes a block of BlockSize ids at a time and
+// numbers from it locally, so the shared atomic is written once per block.
+// Ids are unique across threads and increase within each thread, but threads
+// interleave their blocks, so ids are not in global creation order. Tag keeps
+// the counters of unrelated id spaces apart.
+template <typename Tag, std::uint64_t BlockSize = 4096>
+class BlockIdAllocator {
+private:
+    inline static std::atomic<std::uint64_t> nextBlock{0};    // first id no thread holds yet
+    inline static std::atomic<std::uint64_t> generation{0};   // bumped by skipBelow
+
+    struct Block {
+        std::uint64_t next       = 0;
+        std::uint64_t end        = 0;
+        std::uint64_t generation = 0;
+    };
+
+    static Block& local() {
+        thread_local Block block;
+        return block;
+    }
+
+public:
+    BlockIdAllocator() = delete;
+
+    static std::uint64_t next() {
+        Block& block = local();
+        const std::uint64_t current = generation.load(std::memory_order_acquire);
+        if (block.next == block.end || block.generation != current) {
+            block.generation = current;
+            block.next       = nextBlock.fetch_add(BlockSize, std::memory_order_relaxed);
+            block.end        = block.next + BlockSize;
+        }
+        return block.next++;
+    }
+
+    // Makes every id handed out from now on at least `first`, on every
+    // thread: blocks that threads already hold are abandoned
+    static void skipBelow(std::uint64_t first) {
+        std::uint64_t current = nextBlock.load(std::memory_order_relaxed);
+        while (current < first &&
+               !nextBlock.compare_exchange_weak(current, first, std::memory_order_relaxed)) {
+        }
+        generation.fetch_add(1, std::memory_order_release);
+    }
+};
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#include "Stats/CycleClock.hpp"
+
+// system_clock time read from the cycle counter: a tick read and a multiply
+// per call instead of a system_clock call. Anchored to system_clock by
+// calibrate() (or else on first use) and again every reanchorInterval, so it
+// drifts by at most the tick calibration error over that interval. It never
+// runs backwards: after a re-anchor that lands behind its last reading it
+// holds that reading until system_clock catches up. Keeps state; use one per
+// thread (or per book).
+class TscClock {
+public:
+    using time_point = std::chrono::system_clock::time_point;
+
+    static constexpr std::chrono::milliseconds reanchorInterval{10};
+
+    // Measures the tick rate and anchors the clock now, so the first now()
+    // does not pay for it: measuring takes a few milliseconds (once per
+    // process), which is not to be spent on a message
+    void calibrate() { reanchor(); }
+
+    time_point now() {
+        const std::uint64_t ticks = CycleClock::now();
+        // Also taken on the first call, and if the counter went backwards
+        if (ticks - anchorTicks >= reanchorTicks) {
+            reanchor();
+            return last;
+        }
+        const auto elapsed = std::chrono::nanoseconds{
+            static_cast<std::int64_t>(static_cast<double>(ticks - anchorTicks) * nanosPerTick)};
+        last = std::max(last, anchor + std::chrono::duration_cast<std::chrono::system_clock::duration>(elapsed));
+        return last;
+    }
+
+private:
+    time_point    anchor{};
+    time_point    last{};
+    std::uint64_t anchorTicks   = 0;
+    std::uint64_t reanchorTicks = 0;   // 0 until calibrated
+    double        nanosPerTick  = 0;
+
+    void reanchor();
+};
+
+// Where a book's order and event timestamps come from
+enum class ClockSource : std::uint8_t {
+    System,      // system_clock::now()
+    Tsc,         // a TscClock
+    Simulated    // whatever the owner set last: deterministic, for replay and tests
+};
+
+// How many clock reads an inbound message (an add, cancel, modify or match)
+// costs
+enum class Stamping : std::uint8_t {
+    PerMessage,  // one, at the first thing that needs a time; every event the message raises shares it
+    PerEvent     // one per event
+};
+
+// A book's clock: the source it reads and how often it reads it. A Tsc clock
+// is calibrated when it is constructed, off the matching path. The book
+// calls beginMessage as each inbound message arrives and stamp for each
+// timestamp that message needs, so under PerMessage a sweep through a
+// hundred orders reads the clock once, and a message that needs no time
+// (a cancel nobody listens to) reads it not at all.
+class EngineClock {
+public:
+    using time_point = std::chrono::system_clock::time_point;
+
+    explicit EngineClock(ClockSource source = ClockSource::Tsc,
+                         Stamping stamping = Stamping::PerMessage,
+                         time_point start = time_point{})
+        : source(source), stamping(stamping), simulated(start) {
+        if (source == ClockSource::Tsc) {
+            tsc.calibrate();
+        }
+    }
+
+    time_point now() {
+        switch (source) {
+          case ClockSource::Tsc:       return tsc.now();
+          case ClockSource::Simulated: return simulated;
+          case ClockSource::System:    break;
+        }
+        return std::chrono::system_clock::now();
+    }
+
+    void beginMessage() { stamped = false; }
+
+    // The time to give the next order or event of the message in progress
+    time_point stamp() {
+        if (!stamped || stamping == Stamping::PerEvent) {
+            messageTime = now();
+            stamped     = true;
+        }
+        return messageTime;
+    }
+
+    // Move a Simulated clock; the other sources ignore these
+    void set(time_point time)                { simulated = time; }
+    void advance(std::chrono::nanoseconds by) {
+        simulated += std::chrono::duration_cast<std::chrono::system_clock::duration>(by);
+    }
+
+    ClockSource getSource()   const { return source; }
+    Stamping    getStamping() const { return stamping; }
+
+private:
+    ClockSource source;
+    Stamping    stamping;
+    TscClock    tsc;
+    time_point  simulated;
+    time_point  messageTime{};
+    bool        stamped = false;
+};
+
+// Swaps a book's clock for another until the end of the scope
+template <typename Book>
+class ScopedClock {
+public:
+    ScopedClock(Book& book, const EngineClock& clock) : book(book), saved(book.getClock()) { book.setClock(clock); }
+    ~ScopedClock() { book.setClock(saved); }
+
+    ScopedClock(const ScopedClock&) = delete;
+    ScopedClock& operator=(const ScopedClock&) = delete;
+
+private:
+    Book&       book;
+    EngineClock saved;
+};
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Engine/EngineThread.hpp"
+#include "Engine/OrderCommand.hpp"
+#include "Engine/SpscQueue.hpp"
+
+// What submit does when the ingress queue is full
+enum class Backpressure {
+    Spin,    // busy-wait until the matching thread frees a slot
+    Yield,   // wait, yielding the producer's core between attempts
+    Reject   // give up at once; submit returns false
+};
+
+struct RunnerOptions {
+    std::size_t  queueCapacity = std::size_t{1} << 16;
+    Backpressure backpressure  = Backpressure::Spin;
+    int          cpu           = -1;   // core to pin the matching thread to; -1 leaves it unpinned
+    // Queued commands the matching thread applies as one applyBatch, for
+    // books that have it; observers then see one block per batch. 1 applies
+    // and publishes command by command.
+    std::size_t  batchSize     = 1;
+};
+
+// Runs a book (OrderBook or any BasicOrderBook) on a dedicated matching
+// thread fed through a lock-free single-producer ingress queue. The book may
+// also be any target with bool apply(const OrderCommand&), which then decides
+// how each command is applied (see MultiBookEngine). One producer
+// thread submits commands; the matching thread busy-polls the queue and
+// applies them in order, so observers of the book are called on the matching
+// thread.
+//
+// While the runner is running, nothing else may touch the book. stop() (or
+// the destructor) applies every command already submitted, then joins the
+// matching thread; after that the book may be used directly again.
+template <typename Book>
+class EngineRunner {
+private:
+    Book&                      book;
+    SpscQueue<OrderCommand>    queue;
+    Backpressure               backpressure;
+
+    std::atomic<bool>          stopping{false};
+    std::atomic<bool>          pinned{false};
+    // Written by the matching thread only
+    std::atomic<std::uint64_t> processed{0};
+    std::atomic<std::uint64_t> rejected{0};
+    // The matching thread's batch of popped commands
+    std::vector<OrderCommand>  pending;
+
+    std::thread                matcher;
+
+    static constexpr bool batches = requires(Book& b, std::span<const OrderCommand> commands) {
+        b.applyBatch(commands);
+    };
+
+    static void bump(std::atomic<std::uint64_t>& counter, std::uint64_t by = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+
+    // Commands the book refuses (a duplicate id, an unknown cancel) cannot be
+    // reported back to the producer; they are counted instead
+    void apply(const OrderCommand& command) {
+        try {
+            bool accepted;
+            if constexpr (requires { book.apply(command); }) {
+                accepted = book.apply(command);
+            } else {
+                accepted = applyCommand(book, command);
+            }
+            if (!accepted) {
+                bump(rejected);
+            }
+        } catch (const std::exception&) {
+            bump(rejected);
+        }
+        bump(processed);
+    }
+
+    void applyBatch(std::span<const OrderCommand> commands) {
+        try {
+            bump(rejected, book.applyBatch(commands).rejected);
+        } catch (const std::exception&) {
+            // Not a refusal the book reports per command; which of them
+            // took effect is unknown
+            bump(rejected, commands.size());
+        }
+        bump(processed, commands.size());
+    }
+
+    // Applies what is queued, up to one batch; false if the queue was empty
+    bool drain() {
+        if constexpr (batches) {
+            if (pending.size() > 1) {
+                std::size_t count = 0;
+                while (count < pending.size() && queue.tryPop(pending[count])) {
+                    ++count;
+                }
+                if (count > 0) {
+                    applyBatch(std::span<const OrderCommand>(pending.data(), count));
+                }
+                return count > 0;
+            }
+        }
+        OrderCommand command;
+        if (!queue.tryPop(command)) {
+            return false;
+        }
+        apply(command);
+        return true;
+    }
+
+    void run(int cpu) {
+        if (cpu >= 0) {
+            pinned.store(pinCurrentThread(cpu), std::memory_order_relaxed);
+        }
+
+        for (;;) {
+            if (drain()) {
+                continue;
+            }
+            if (stopping.load(std::memory_order_acquire)) {
+                // Everything submitted before stop() is in the queue by now
+                while (drain()) {
+                }
+                return;
+            }
+            // Lets buffering observers meet their flush deadlines while
+            // nothing arrives
+            if constexpr (requires { book.idle(); }) {
+                book.idle();
+            }
+            cpuRelax();
+        }
+    }
+
+public:
+    explicit EngineRunner(Book& book, RunnerOptions options = RunnerOptions{})
+        : book(book), queue(options.queueCapacity), backpressure(options.backpressure),
+          pending(std::max<std::size_t>(options.batchSize, 1)),
+          matcher([this, cpu = options.cpu] { run(cpu); }) {}
+
+    ~EngineRunner() { stop(); }
+
+    EngineRunner(const EngineRunner&) = delete;
+    EngineRunner& operator=(const EngineRunner&) = delete;
+
+    // Producer thread only, and not after stop(). Returns false only when the
+    // queue is full under Backpressure::Reject.
+    bool submit(const OrderCommand& command) {
+        while (!queue.tryPush(command)) {
+            switch (backpressure) {
+                case Backpressure::Spin:   cpuRelax(); break;
+                case Backpressure::Yield:  std::this_thread::yield(); break;
+                case Backpressure::Reject: return false;
+            }
+        }
+        return true;
+    }
+
+    bool addOrder(std::string_view orderId, OrderType type, Price price, int quantity) {
+        return submit(OrderCommand::add(orderId, type, price, quantity));
+    }
+    bool cancel(std::string_view orderId) {
+        return submit(OrderCommand::cancel(orderId));
+    }
+    bool modify(std::string_view orderId, int quantity, Price price) {
+        return submit(OrderCommand::modify(orderId, quantity, price));
+    }
+
+    // Drains the queue and joins the matching thread; safe to call twice
+    void stop() {
+        stopping.store(true, std::memory_order_release);
+        if (matcher.joinable()) {
+            matcher.join();
+        }
+    }
+
+    // Commands applied so far, and how many of them the book refused
+    std::uint64_t getProcessedCount() const { return processed.load(std::memory_order_relaxed); }
+    std::uint64_t getRejectedCount()  const { return rejected.load(std::memory_order_relaxed); }
+
+    // Whether the matching thread pinned itself to RunnerOptions::cpu; settled
+    // once it has started (and certainly after stop())
+    bool isPinned() const { return pinned.load(std::memory_order_relaxed); }
+};
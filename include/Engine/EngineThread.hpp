@@ -0,0 +1,15 @@
+#pragma once
+
+// Pins the calling thread to one CPU core. Returns false if the platform does
+// not support it or the core is not available to this process.
+bool pinCurrentThread(int cpu);
+
+// Spin-wait hint: lets the core's sibling hyperthread run and saves power
+// while a thread busy-polls
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/EngineRunner.hpp"
+#include "Engine/OrderCommand.hpp"
+#include "OrderBook.hpp"
+
+struct EngineOptions {
+    std::size_t   shards = 1;   // worker threads; each owns a fixed subset of the symbols
+    // Per shard; a cpu >= 0 pins shard i to core cpu + i, and a batchSize > 1
+    // hands each book its share of a batch through applyBatch
+    RunnerOptions runner;
+};
+
+// One book per symbol, partitioned round-robin across shards. Each shard is an
+// EngineRunner thread that owns its books outright, so matching takes no
+// locks; the engine only routes each command to the shard holding its symbol.
+//
+// The set of symbols is fixed at construction. Books are created stopped so
+// observers can be attached (book()), then start() launches the shards.
+// Commands are submitted from a single thread. While running, books belong to
+// their shard threads; stop() applies everything submitted and joins them.
+template <typename Book = OrderBook>
+class MultiBookEngine {
+public:
+    using BookFactory = std::function<std::unique_ptr<Book>(std::string_view symbol)>;
+
+private:
+    // The books of one shard; the runner target
+    struct Shard {
+        std::vector<std::unique_ptr<Book>> books;
+
+        bool apply(const OrderCommand& command) { return applyCommand(*books[command.book], command); }
+
+        // A batch popped by the runner (RunnerOptions::batchSize): each run
+        // of consecutive commands for one book goes to that book's
+        // applyBatch, so its observers see one block per run
+        BatchResult applyBatch(std::span<const OrderCommand> commands) {
+            BatchResult result;
+            for (std::size_t first = 0; first < commands.size();) {
+                std::size_t last = first + 1;
+                while (last < commands.size() && commands[last].book == commands[first].book) {
+                    ++last;
+                }
+                Book& book = *books[commands[first].book];
+                const auto run = commands.subspan(first, last - first);
+                if constexpr (requires { book.applyBatch(run); }) {
+                    const BatchResult applied = book.applyBatch(run);
+                    result.applied  += applied.applied;
+                    result.rejected += applied.rejected;
+                } else {
+                    for (const auto& command : run) {
+                        bool accepted = false;
+                        try {
+                            accepted = applyCommand(book, command);
+                        } catch (const std::invalid_argument&) {
+                        } catch (const std::length_error&) {
+                        }
+                        ++(accepted ? result.applied : result.rejected);
+                    }
+                }
+                first = last;
+            }
+            return result;
+        }
+
+        // The runner's queue is empty: idle every book of the shard
+        void idle() {
+            for (auto& book : books) {
+                if constexpr (requires { book->idle(); }) {
+                    book->idle();
+                }
+            }
+        }
+    };
+
+    struct Route {
+        std::uint32_t shard;
+        std::uint32_t book;
+    };
+
+    struct SymbolHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
+    EngineOptions                                                         options;
+    std::vector<Shard>                                                    shards;
+    std::unordered_map<std::string, Route, SymbolHash, std::equal_to<>>   routes;
+    std::vector<std::unique_ptr<EngineRunner<Shard>>>                     runners;
+    bool                                                                  isRunning = false;
+
+    const Route& routeOf(std::string_view symbol) const {
+        const auto it = routes.find(symbol);
+        if (it == routes.end()) {
+            throw std::invalid_argument("MultiBookEngine: unknown symbol " + std::string(symbol));
+        }
+        return it->second;
+    }
+
+public:
+    // Throws std::invalid_argument for a repeated symbol
+    explicit MultiBookEngine(const std::vector<std::string>& symbols,
+                             EngineOptions options = EngineOptions{},
+                             BookFactory makeBook = [](std::string_view) { return std::make_unique<Book>(); })
+        : options(options), shards(std::max<std::size_t>(options.shards, 1)) {
+        for (std::size_t i = 0; i < symbols.size(); ++i) {
+            auto& shard = shards[i % shards.size()];
+            const Route route{static_cast<std::uint32_t>(i % shards.size()),
+                              static_cast<std::uint32_t>(shard.books.size())};
+            if (!routes.emplace(symbols[i], route).second) {
+                throw std::invalid_argument("MultiBookEngine: duplicate symbol " + symbols[i]);
+            }
+            shard.books.push_back(makeBook(symbols[i]));
+        }
+    }
+
+    ~MultiBookEngine() { stop(); }
+
+    MultiBookEngine(const MultiBookEngine&) = delete;
+    MultiBookEngine& operator=(const MultiBookEngine&) = delete;
+
+    // Launches the shard threads; starting again after stop() resets the
+    // processed/rejected counts
+    void start() {
+        if (isRunning) {
+            return;
+        }
+        runners.clear();
+        for (std::size_t i = 0; i < shards.size(); ++i) {
+            RunnerOptions runnerOptions = options.runner;
+            if (runnerOptions.cpu >= 0) {
+                runnerOptions.cpu += static_cast<int>(i);
+            }
+            runners.push_back(std::make_unique<EngineRunner<Shard>>(shards[i], runnerOptions));
+        }
+        isRunning = true;
+    }
+
+    // Applies every submitted command, then joins the shard threads
+    void stop() {
+        for (auto& runner : runners) {
+            runner->stop();
+        }
+        isRunning = false;
+    }
+
+    bool running() const { return isRunning; }
+
+    // Queue a command for the symbol's shard. Returns false, queueing
+    // nothing, while the engine is not running (before start(), after
+    // stop()), and if the shard's queue is full under Backpressure::Reject.
+    // Throws std::invalid_argument for an unknown symbol.
+    bool submit(std::string_view symbol, OrderCommand command) {
+        const Route& route = routeOf(symbol);
+        if (!isRunning) {
+            return false;
+        }
+        command.book = route.book;
+        return runners[route.shard]->submit(command);
+    }
+
+    bool addOrder(std::string_view symbol, std::string_view orderId, OrderType type, Price price, int quantity) {
+        return submit(symbol, OrderCommand::add(orderId, type, price, quantity));
+    }
+    bool cancel(std::string_view symbol, std::string_view orderId) {
+        return submit(symbol, OrderCommand::cancel(orderId));
+    }
+    bool modify(std::string_view symbol, std::string_view orderId, int quantity, Price price) {
+        return submit(symbol, OrderCommand::modify(orderId, quantity, price));
+    }
+
+    // The book for a symbol; only touch it while the engine is not running.
+    // Throws std::invalid_argument for an unknown symbol.
+    Book& book(std::string_view symbol) {
+        const Route& route = routeOf(symbol);
+        return *shards[route.shard].books[route.book];
+    }
+
+    // The symbol's best bid and offer; safe while running, when it may trail
+    // the shard by the commands still in flight. Throws std::invalid_argument
+    // for an unknown symbol.
+    TopOfBook topOfBook(std::string_view symbol) const {
+        const Route& route = routeOf(symbol);
+        return shards[route.shard].books[route.book]->loadTopOfBook();
+    }
+
+    std::size_t getShardCount()  const { return shards.size(); }
+    std::size_t getSymbolCount() const { return routes.size(); }
+
+    // Which shard trades a symbol
+    std::size_t shardOf(std::string_view symbol) const { return routeOf(symbol).shard; }
+
+    // Commands applied, and refused by their book, across all shards
+    std::uint64_t getProcessedCount() const {
+        std::uint64_t total = 0;
+        for (const auto& runner : runners) total += runner->getProcessedCount();
+        return total;
+    }
+    std::uint64_t getRejectedCount() const {
+        std::uint64_t total = 0;
+        for (const auto& runner : runners) total += runner->getRejectedCount();
+        return total;
+    }
+};
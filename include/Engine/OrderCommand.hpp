@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+
+#include "Price.hpp"
+#include "Interfaces/IOrder.hpp"
+#include "Events/OrderEvent.hpp"
+
+enum class CommandType : std::uint8_t {
+    Add,
+    Cancel,
+    Modify
+};
+
+// One instruction for a book, as plain data so it can be queued and handed
+// between threads by value. For Cancel only the order's id is used, for
+// Modify its id, price and quantity; book picks the book when the command
+// goes to a target holding several. The factories throw
+// std::invalid_argument for ids the book would not accept (longer than
+// OrderSnapshot::maxIdLength), since the id is stored inline.
+struct OrderCommand {
+    CommandType   type;
+    TimeInForce   timeInForce;   // Add only
+    std::uint32_t book;
+    OrderSnapshot order;
+
+    static void checkId(std::string_view orderId) {
+        if (orderId.size() > OrderSnapshot::maxIdLength) {
+            throw std::invalid_argument("OrderCommand: order id too long");
+        }
+    }
+
+    static OrderCommand add(std::string_view orderId, OrderType side, Price price, int quantity,
+                            TimeInForce timeInForce = TimeInForce::GoodTillCancel) {
+        checkId(orderId);
+        OrderCommand command{};
+        command.type        = CommandType::Add;
+        command.timeInForce = timeInForce;
+        command.order.setId(orderId);
+        command.order.side     = side;
+        command.order.price    = price;
+        command.order.quantity = quantity;
+        return command;
+    }
+
+    static OrderCommand cancel(std::string_view orderId) {
+        checkId(orderId);
+        OrderCommand command{};
+        command.type = CommandType::Cancel;
+        command.order.setId(orderId);
+        return command;
+    }
+
+    static OrderCommand modify(std::string_view orderId, int quantity, Price price) {
+        checkId(orderId);
+        OrderCommand command{};
+        command.type = CommandType::Modify;
+        command.order.setId(orderId);
+        command.order.price    = price;
+        command.order.quantity = quantity;
+        return command;
+    }
+};
+
+// Applies a command to a book. Returns false for a cancel or modify that
+// found nothing; the book's own exceptions (e.g. a duplicate id) propagate.
+template <typename Book>
+bool applyCommand(Book& book, const OrderCommand& command) {
+    const auto& o = command.order;
+    switch (command.type) {
+        case CommandType::Add:
+            book.addOrder(o.getId(), o.side, o.price, o.quantity, command.timeInForce);
+            return true;
+        case CommandType::Modify:
+            return book.modify(o.getId(), o.quantity, o.price);
+        case CommandType::Cancel:
+            break;
+    }
+    return book.cancel(o.getId());
+}
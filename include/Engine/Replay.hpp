@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "Events/OrderEvent.hpp"
+#include "OrderBook.hpp"
+
+struct ReplayOptions {
+    // 0 replays as fast as possible; otherwise events are paced by their
+    // captured timestamps, sped up by this factor (1 is the captured pace)
+    double speed = 0;
+    // Stamp the replayed orders and events with their captured timestamps
+    // (through a Simulated clock) rather than the time of the replay, so a
+    // replay's output is the same every run
+    bool capturedTime = false;
+};
+
+struct ReplayReport {
+    std::uint64_t messages       = 0;   // adds, cancels and modifies driven into the book
+    std::uint64_t rejected       = 0;   // adds the book refused, cancels and modifies of orders not resting
+    std::uint64_t capturedTrades = 0;   // trades in the capture; re-derived, not replayed
+    std::uint64_t trades         = 0;   // trades the replay produced
+    double        seconds        = 0;   // wall time spent driving the book
+    std::uint64_t checksum       = 0;   // bookChecksum of the final book
+
+    double messagesPerSecond() const { return seconds > 0 ? static_cast<double>(messages) / seconds : 0; }
+};
+
+// Drives captured events (from a TradeLog JSONL file or an EventJournal, see
+// JsonlReader and JournalReader) into a book: adds through addOrder, cancels
+// through cancel and modifies through modify, while the captured trades are
+// only counted, since the book derives its own. Observers attached to the book see the replayed events.
+ReplayReport replay(OrderBook& book, std::span<const OrderEvent> events, ReplayOptions options = ReplayOptions{});
+
+// FNV-1a hash of every resting order (side, price, id, quantity) in priority
+// order; equal books hash equal
+std::uint64_t bookChecksum(const OrderBook& book);
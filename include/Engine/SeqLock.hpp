@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Publishes a small plain value from one writer thread to any number of
+// reader threads without locks. The writer never waits; a reader that
+// overlaps a write retries until it has copied a version nobody was writing.
+//
+// The value is held as relaxed atomic words, so concurrent copies are not
+// data races; the sequence (odd while a write is in progress) orders them.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T>, "SeqLock holds plain values");
+
+private:
+    static constexpr std::size_t cacheLine = 64;
+    static constexpr std::size_t wordCount = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    alignas(cacheLine) std::atomic<std::uint64_t> sequence{0};
+    std::atomic<std::uint64_t>                    words[wordCount] = {};
+
+public:
+    SeqLock() = default;
+    explicit SeqLock(const T& value) { store(value); }
+
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    // Writer thread only
+    void store(const T& value) {
+        std::uint64_t buffer[wordCount] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        const std::uint64_t version = sequence.load(std::memory_order_relaxed);
+        sequence.store(version + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (std::size_t i = 0; i < wordCount; ++i) {
+            words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence.store(version + 2, std::memory_order_release);
+    }
+
+    // Any thread
+    T load() const {
+        std::uint64_t buffer[wordCount];
+        std::uint64_t before;
+        std::uint64_t after;
+        do {
+            before = sequence.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < wordCount; ++i) {
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    // Number of completed writes
+    std::uint64_t version() const { return sequence.load(std::memory_order_acquire) / 2; }
+};
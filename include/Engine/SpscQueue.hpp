@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Bounded lock-free queue for exactly one producer thread and one consumer
+// thread. Each side owns one index and keeps a cached copy of the other's, so
+// it only touches the shared cache line when its cached view runs out. The
+// capacity is rounded up to a power of two.
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "SpscQueue holds plain values");
+
+private:
+    static constexpr std::size_t cacheLine = 64;
+
+    std::vector<T> slots;
+    std::size_t    mask;
+
+    // Consumer side: next slot to read, and the last tail it saw
+    alignas(cacheLine) std::atomic<std::size_t> head{0};
+    std::size_t                                 cachedTail = 0;
+
+    // Producer side: next slot to write, and the last head it saw
+    alignas(cacheLine) std::atomic<std::size_t> tail{0};
+    std::size_t                                 cachedHead = 0;
+
+    static std::size_t roundUp(std::size_t capacity) {
+        std::size_t size = 1;
+        while (size < capacity) size <<= 1;
+        return size;
+    }
+
+public:
+    explicit SpscQueue(std::size_t capacity)
+        : slots(roundUp(capacity < 2 ? 2 : capacity)), mask(slots.size() - 1) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    std::size_t capacity() const { return slots.size(); }
+
+    // Producer only. Returns false if the queue is full.
+    bool tryPush(const T& value) {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead == slots.size()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead == slots.size()) {
+                return false;
+            }
+        }
+        slots[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool tryPop(T& value) {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) {
+                return false;
+            }
+        }
+        value = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Either side; only a snapshot while the other side is active
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "OrderId.hpp"
+
+// Where a journal stood after some event: enough to read on from there, or
+// to carry on writing it, without going through what came before. Book
+// snapshots keep the checkpoint of the last event they reflect, so recovery
+// replays only the journal's tail (see OrderBook::recover).
+struct JournalCheckpoint {
+	std::uint64_t sequence     = 0;   // last event covered; 0 before the first
+	std::uint64_t offset       = 0;   // bytes of the file covered, header included; 0 if unknown
+	std::uint64_t nextInterned = 0;   // next interned id number, without internedIdBit
+	OrderId       nextOrderId  = 0;   // one past the largest numeric order id journalled
+	// The interned ids records after offset may use without defining them
+	std::unordered_map<std::uint64_t, std::string> internedIds;
+};
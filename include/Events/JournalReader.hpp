@@ -0,0 +1,56 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "Events/JournalCheckpoint.hpp"
+#include "Events/JournalRecord.hpp"
+#include "Events/OrderEvent.hpp"
+
+// Reads a binary journal written by EventJournal back as OrderEvents, in
+// order. Each event's sequence is its journal sequence; snapshot fields the
+// journal does not keep (the quantities left on the orders of a trade) are 0.
+class JournalReader {
+public:
+	// Throws std::runtime_error if the file cannot be opened or is not a
+	// journal of a version this reader understands
+	explicit JournalReader(const std::string& fileName);
+	// Reads on from a checkpoint of the same journal (a snapshot's, or
+	// position()), skipping everything before it. Also throws
+	// std::runtime_error if the file is shorter than the checkpoint.
+	JournalReader(const std::string& fileName, const JournalCheckpoint& from);
+
+	// Reads the next event; false at the end of the journal. A record cut
+	// short by a crash also ends the journal, and sets truncated().
+	bool next(OrderEvent& event);
+
+	bool truncated() const { return truncated_; }
+
+	// Bytes of the file read so far as whole records, header included
+	std::uint64_t validLength() const { return validLength_; }
+
+	// Where the records read so far leave the journal
+	JournalCheckpoint position() const;
+
+	// Interned order ids defined so far, by number
+	const std::unordered_map<std::uint64_t, std::string>& internedIds() const { return interned_; }
+
+	// The text of a journalled order id
+	std::string idText(std::uint64_t id) const;
+
+	// True if the file starts with the journal magic
+	static bool isJournal(const std::string& fileName);
+
+private:
+	std::ifstream in_;
+	bool truncated_ = false;
+	std::uint64_t validLength_ = 0;
+	std::uint64_t sequence_ = 0;
+	std::uint64_t nextInterned_ = 0;
+	OrderId nextOrderId_ = 0;
+	std::unordered_map<std::uint64_t, std::string> interned_;
+
+	void see(std::uint64_t id);
+};
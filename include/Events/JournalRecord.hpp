@@ -0,0 +1,64 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Price.hpp"
+
+// Binary event journal layout (see EventJournal and JournalReader).
+//
+// A journal file is a JournalFileHeader followed by records. Every record
+// starts with its own size in bytes, so a reader can skip record types it does
+// not know. Fields are stored in the writer's native byte order.
+//
+// Order ids are 64-bit integers. An id that is a plain decimal number below
+// 10^18 is stored as that number; any other id is given a number with
+// internedIdBit set, defined once by a JournalIdRecord written before the
+// first record that uses it.
+
+enum class JournalRecordType : std::uint8_t {
+	Add    = 1,
+	Remove = 2,
+	Match  = 3,
+	Id     = 4,
+	Modify = 5
+};
+
+inline constexpr char          journalMagic[8] = {'O', 'B', 'J', 'R', 'N', 'L', '\0', '\0'};
+inline constexpr std::uint16_t journalVersion  = 1;
+inline constexpr std::uint64_t internedIdBit   = std::uint64_t{1} << 63;
+
+struct JournalFileHeader {
+	char          magic[8];
+	std::uint16_t version;
+	std::uint16_t reserved[3];
+};
+
+// ADD, REMOVE: orderId, side, price and quantity of the order added or
+// cancelled. MODIFY: the same for the order as amended. MATCH: orderId is the buy order, contraId the sell order, price
+// the trade price and quantity the amount traded.
+struct JournalEventRecord {
+	std::uint16_t     length;
+	JournalRecordType type;
+	std::uint8_t      side;         // OrderType
+	std::int32_t      quantity;
+	std::uint64_t     sequence;     // across every event in the journal, from 1
+	std::int64_t      timestampNs;  // system_clock, since the epoch
+	std::uint64_t     orderId;
+	std::uint64_t     contraId;
+	Price             price;
+};
+
+// Binds an interned order id number to its text
+struct JournalIdRecord {
+	std::uint16_t     length;
+	JournalRecordType type;
+	std::uint8_t      idLength;
+	std::uint32_t     reserved;
+	std::uint64_t     orderId;
+	char              id[32];
+};
+
+static_assert(sizeof(JournalFileHeader) == 16);
+static_assert(sizeof(JournalEventRecord) == 48 && std::is_trivially_copyable_v<JournalEventRecord>);
+static_assert(sizeof(JournalIdRecord) == 48 && std::is_trivially_copyable_v<JournalIdRecord>);
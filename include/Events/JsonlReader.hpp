@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "Events/OrderEvent.hpp"
+
+// Reads a TradeLog JSONL file back as OrderEvents, in order. Each event's
+// sequence is its position in the file, from 1; fields the schema does not
+// carry (a cancel's price, the quantities left after a trade) are 0, and
+// timestamps have millisecond resolution.
+class JsonlReader {
+public:
+	// Throws std::runtime_error if the file cannot be opened
+	explicit JsonlReader(const std::string& fileName);
+
+	// Reads the next event, skipping blank lines; false at the end of the
+	// file. Throws std::runtime_error, naming the line, for a line that is
+	// not a TradeLog event.
+	bool next(OrderEvent& event);
+
+private:
+	std::ifstream in_;
+	std::string line_;
+	std::uint64_t lineNumber_ = 0;
+	std::uint64_t sequence_ = 0;
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+#include "Price.hpp"
+#include "Interfaces/IOrder.hpp"
+
+// Aggregate state of one price level: the L2 view of the book
+struct DepthLevel {
+	Price          price;
+	std::int64_t   quantity;     // total remaining quantity resting at the price
+	std::uint32_t  orderCount;
+
+	bool operator==(const DepthLevel&) const = default;
+};
+
+// A price level changed by a book operation, as it stood once the operation
+// completed; quantity and orderCount are 0 when the level has emptied.
+// sequence is the book's last event sequence at that point, so updates line
+// up with the OrderEvents of the same operation.
+struct LevelUpdate {
+	OrderType      side;
+	DepthLevel     level;
+	std::uint64_t  sequence;
+};
+
+static_assert(std::is_trivially_copyable_v<LevelUpdate>);
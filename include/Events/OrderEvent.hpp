@@ -0,0 +1,59 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include "Price.hpp"
+#include "Interfaces/IOrder.hpp"
+
+enum class OrderEventType {
+	ADD,
+	REMOVE,
+	MATCH,
+	MODIFY
+};
+
+// An order as it stood when an event was raised. The id is stored inline, so
+// the snapshot (and the event holding it) is plain data that can be copied,
+// buffered and kept after the order itself is gone.
+struct OrderSnapshot {
+	static constexpr std::size_t maxIdLength = 31;
+
+	char          id[maxIdLength];
+	std::uint8_t  idLength;
+	OrderType     side;
+	Price         price;
+	int           quantity;   // remaining after the event
+
+	std::string_view getId() const { return {id, idLength}; }
+
+	// ids longer than maxIdLength are cut short; the book rejects them on entry
+	void setId(std::string_view orderId) {
+		idLength = static_cast<std::uint8_t>(std::min(orderId.size(), maxIdLength));
+		std::copy_n(orderId.data(), idLength, id);
+	}
+};
+
+// One book event, tagged by type:
+//   ADD, REMOVE  order is the order added or cancelled
+//   MATCH        order is the buy side, contra the sell side, quantity the
+//                amount traded; the trade price is the buy order's price
+//   MODIFY       order is the order as amended, contra the same order as it
+//                stood before, quantity its new quantity
+// sequence numbers the events of one book, starting from 1.
+struct OrderEvent {
+	OrderEventType                        type;
+	std::uint64_t                         sequence;
+	std::chrono::system_clock::time_point timestamp;
+	OrderSnapshot                         order;
+	OrderSnapshot                         contra;
+	int                                   quantity;
+
+	const OrderSnapshot& buyOrder()  const { return order; }
+	const OrderSnapshot& sellOrder() const { return contra; }
+};
+
+static_assert(std::is_trivially_copyable_v<OrderEvent>);
@@ -2,12 +2,12 @@
 #include "Interfaces/IOrder.hpp"
 #include "Interfaces/IEvent.hpp"
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 class TradeEvent final : public IEvent{
 private:
-    inline static int nextId;
-    int id;
+    std::uint64_t id;   // unique across threads (BlockIdAllocator)
     int matchQty;
     OrderEventType eventType;
     std::shared_ptr<IOrder> buyOrder;
@@ -19,9 +19,9 @@ public:
     explicit  TradeEvent(std::shared_ptr<IOrder> buy, std::shared_ptr<IOrder> sell, int matchQty);
 
     OrderEventType getEventType() const override;
-    int getId() const override;
+    std::uint64_t getId() const override;
     int getQty() const;
-    double getPrice() const;
+    Price getPrice() const;
     std::shared_ptr<IOrder> getBuyOrder() const;
     std::shared_ptr<IOrder> getSellOrder() const;
     std::chrono::system_clock::time_point getExecutionTime() const override;
@@ -0,0 +1,15 @@
+// IDepthObserver.hpp
+#pragma once
+
+#include <span>
+#include "Events/LevelUpdate.hpp"
+
+// Receives the book's L2 deltas rather than its order events
+class IDepthObserver {
+public:
+    // The levels changed by one book operation, each reported once with its
+    // final state. The span is only valid for the duration of the call.
+    virtual void onLevelUpdates(std::span<const LevelUpdate> updates) = 0;
+
+    virtual ~IDepthObserver() = default;
+};
@@ -1,20 +1,16 @@
 #pragma once
 #include <memory>
 #include <chrono>
+#include <cstdint>
 #include "IOrder.hpp"
-
-enum class OrderEventType {
-	ADD,
-	REMOVE,
-	MATCH
-};
+#include "Events/OrderEvent.hpp"
 
 
 class IEvent {
 	public:
 	virtual ~IEvent() = default;
 
-	virtual int getId() const = 0;
+	virtual std::uint64_t getId() const = 0;
 	virtual OrderEventType getEventType() const = 0;
 	virtual std::chrono::system_clock::time_point getExecutionTime() const = 0;
 	virtual std::shared_ptr<IOrder> getOrder() const = 0;
@@ -2,16 +2,26 @@
 
 #include <string>
 #include <chrono>
+#include <cstdint>
+
+#include "Price.hpp"
 
 enum class OrderType { BUY, SELL };
 
+// What happens to the part of an incoming order that does not fill at once
+enum class TimeInForce : std::uint8_t {
+    GoodTillCancel,      // rests in the book
+    ImmediateOrCancel,   // is cancelled
+    FillOrKill           // nothing: the order trades in full at once or not at all
+};
+
 class IOrder {
 public:
     virtual ~IOrder() = default;
 
-    virtual std::string getId() const = 0;
+    virtual const std::string& getId() const = 0;
     virtual OrderType getType() const = 0;
-    virtual double getPrice() const = 0;
+    virtual Price getPrice() const = 0;
     virtual int getQuantity() const = 0;
     virtual OrderType getOrderType() const = 0;
     virtual std::chrono::system_clock::time_point getTimestamp() const = 0;
@@ -1,12 +1,25 @@
 // IOrderObserver.hpp
 #pragma once
 
-#include <memory>
-#include "Interfaces/IEvent.hpp"
+#include <span>
+#include "Events/OrderEvent.hpp"
 
 class IOrderObserver {
 public:
-    virtual void onOrderEvent (std::shared_ptr<IEvent>) = 0;
+    virtual void onOrderEvent (const OrderEvent& event) = 0;
+
+    // The events raised by one book operation, in order. The span points into
+    // the book's event buffer and is only valid for the duration of the call.
+    virtual void onOrderEvents(std::span<const OrderEvent> events) {
+        for (const auto& event : events) {
+            onOrderEvent(event);
+        }
+    }
+
+    // Called by the book's owner, on the thread that delivers events, while
+    // the book has nothing to do (see BasicOrderBook::idle). An observer that
+    // buffers can write out what is due.
+    virtual void onIdle() {}
 
     virtual ~IOrderObserver() = default;
 };
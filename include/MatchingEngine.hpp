@@ -1,25 +1,165 @@
+#pragma once
 #include "Interfaces//IOrder.hpp"
 #include "Events//TradeEvent.hpp"
+#include "Book/OrderQueue.hpp"
+#include "Book/OrderNode.hpp"
 #include <map>
 #include <vector>
 #include <memory>
 #include <deque>
 #include <algorithm>
+#include <concepts>
+
+// A pooled order node type (see BasicOrderNode)
+template <typename Node>
+concept OrderNodeType = std::derived_from<Node, BasicOrderNode<Node>>;
 
 class MatchingEngine{
   	private:
-	static std::vector<TradeEvent> matchBuy(
+	// Order access for the two shapes the engine matches: IOrder objects and
+	// the book's pooled nodes (any BasicOrderNode). Node access is resolved at
+	// compile time, so the sweep over nodes makes no virtual calls unless the
+	// node type itself does (see SharedOrders).
+	static Price priceOf(const std::shared_ptr<IOrder>& order) { return order->getPrice(); }
+	template <OrderNodeType Node>
+	static Price priceOf(const Node& node) { return node.price; }
+	static int quantityOf(const std::shared_ptr<IOrder>& order) { return order->getQuantity(); }
+	template <OrderNodeType Node>
+	static int quantityOf(const Node& node) { return node.quantity; }
+	static void reduceQuantity(const std::shared_ptr<IOrder>& order, int amount) { order->reduceQuantity(amount); }
+	template <OrderNodeType Node>
+	static void reduceQuantity(Node& node, int amount) { node.reduceQuantity(amount); }
+	// Fills a resting order through its level when the level keeps totals
+	// (PriceLevel), directly otherwise
+	template <typename Level, typename Resting>
+	static void fill(Level& level, Resting& resting, int amount) {
+		if constexpr (requires { level.fill(resting, amount); }) {
+			level.fill(resting, amount);
+		} else {
+			reduceQuantity(resting, amount);
+		}
+	}
+
+	// The incoming order was appended to the back of its own price level before
+	// matching, so once it is completely filled it is the only order that has to
+	// leave that side of the book.
+	template <typename Levels>
+	static void eraseFilledIncoming(
 	const std::shared_ptr<IOrder>& incomingOrder,
-	std::map<double, std::deque<std::shared_ptr<IOrder>>>& sellBook
+	Levels& ownBook
 	);
-	static std::vector<TradeEvent> matchSell(
+    public:
+	static std::vector<TradeEvent> match(
 	const std::shared_ptr<IOrder>& incomingOrder,
-	std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>>& buyBook
+	std::map<Price, OrderQueue, std::greater<>>& buyBook,
+	std::map<Price, OrderQueue>& sellBook
 	);
-    public:
+
+	// Same as above for any level storage (MapLevels, LadderLevels) of
+	// OrderQueue levels. Only the levels the incoming order crosses are touched.
+	template <typename BuyLevels, typename SellLevels>
 	static std::vector<TradeEvent> match(
 	const std::shared_ptr<IOrder>& incomingOrder,
-	std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>>& buyBook,
-	std::map<double, std::deque<std::shared_ptr<IOrder>>>& sellBook
+	BuyLevels& buyBook,
+	SellLevels& sellBook
+	);
+
+	// Fills the incoming order (an IOrder or a pooled order node) against the
+	// best levels of the opposite side for as long as its limit reaches them,
+	// calling onTrade(resting, qty) per fill before quantities are reduced.
+	// Filled resting orders are popped from their level and the levels they
+	// empty are erased; the incoming order's own side is left to the caller.
+	template <typename Incoming, typename Levels, typename OnTrade>
+	static void sweep(
+	Incoming& incomingOrder,
+	Levels& oppositeBook,
+	OnTrade&& onTrade
 	);
-};
\ No newline at end of file
+};
+
+template <typename Incoming, typename Levels, typename OnTrade>
+void MatchingEngine::sweep(
+    Incoming& incomingOrder,
+    Levels& oppositeBook,
+    OnTrade&& onTrade
+) {
+    const typename Levels::key_compare isBetter;
+    const Price limit = priceOf(incomingOrder);
+    int remainingQty = quantityOf(incomingOrder);
+
+    while (remainingQty > 0 && !oppositeBook.empty()) {
+        // Only match while the incoming limit reaches the best opposite price
+        if (isBetter(limit, oppositeBook.bestPrice())) {
+            break;
+        }
+
+        auto& queue = oppositeBook.bestLevel();
+        while (!queue.empty() && remainingQty > 0) {
+            auto& resting = queue.front();
+            int matchQty = std::min(remainingQty, quantityOf(resting));
+
+            onTrade(resting, matchQty);
+
+            // Reduce both sides
+            reduceQuantity(incomingOrder, matchQty);
+            fill(queue, resting, matchQty);
+            remainingQty -= matchQty;
+
+            if (quantityOf(resting) == 0) {
+                queue.pop_front();
+            }
+        }
+
+        // Erase empty price level
+        if (queue.empty()) {
+            oppositeBook.eraseBest();
+        }
+    }
+}
+
+template <typename Levels>
+void MatchingEngine::eraseFilledIncoming(
+    const std::shared_ptr<IOrder>& incomingOrder,
+    Levels& ownBook
+) {
+    auto* queue = ownBook.find(incomingOrder->getPrice());
+    if (queue == nullptr) {
+        return;
+    }
+
+    auto pos = std::find(queue->rbegin(), queue->rend(), incomingOrder);
+    if (pos != queue->rend()) {
+        queue->erase(std::next(pos).base());
+    }
+    if (queue->empty()) {
+        ownBook.erase(incomingOrder->getPrice());
+    }
+}
+
+template <typename BuyLevels, typename SellLevels>
+std::vector<TradeEvent> MatchingEngine::match(
+    const std::shared_ptr<IOrder>& incomingOrder,
+    BuyLevels& buyBook,
+    SellLevels& sellBook
+) {
+    std::vector<TradeEvent> trades;
+    if (incomingOrder->getType() == OrderType::BUY) {
+        // Record the trade (buy side first)
+        sweep(incomingOrder, sellBook, [&](const std::shared_ptr<IOrder>& resting, int qty) {
+            trades.emplace_back(incomingOrder, resting, qty);
+        });
+        if (incomingOrder->getQuantity() <= 0) {
+            eraseFilledIncoming(incomingOrder, buyBook);
+        }
+    } else {
+        // Record the trade (buy side is the resting order)
+        sweep(incomingOrder, buyBook, [&](const std::shared_ptr<IOrder>& resting, int qty) {
+            trades.emplace_back(resting, incomingOrder, qty);
+        });
+        if (incomingOrder->getQuantity() <= 0) {
+            eraseFilledIncoming(incomingOrder, sellBook);
+        }
+    }
+
+    return trades;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Events/LevelUpdate.hpp"
+#include "Events/OrderEvent.hpp"
+#include "Interfaces/IDepthObserver.hpp"
+#include "Interfaces/IOrderObserver.hpp"
+
+// BasicOrderBook observer that forwards each operation's events, and its L2
+// deltas, to the observers registered at run time. While none of a kind is
+// registered it tells the book not to build that kind at all.
+class DynamicObservers {
+private:
+    std::vector<std::shared_ptr<IOrderObserver>>  observers;
+    std::vector<std::shared_ptr<IDepthObserver>>  depthObservers;
+
+public:
+    void add   (const std::shared_ptr<IOrderObserver>& observer);
+    void remove(const std::shared_ptr<IOrderObserver>& observer);
+    void addDepth   (const std::shared_ptr<IDepthObserver>& observer);
+    void removeDepth(const std::shared_ptr<IDepthObserver>& observer);
+
+    bool wantsEvents() const { return !observers.empty(); }
+    void onEvents(std::span<const OrderEvent> events);
+    void onIdle();
+
+    bool wantsLevelUpdates() const { return !depthObservers.empty(); }
+    void onLevelUpdates(std::span<const LevelUpdate> updates);
+};
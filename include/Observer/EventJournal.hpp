@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Interfaces/IOrderObserver.hpp"
+#include "Events/JournalCheckpoint.hpp"
+#include "Events/JournalRecord.hpp"
+#include "Events/OrderEvent.hpp"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+// Records every order event in the binary journal format (JournalRecord.hpp):
+// one fixed-size record per event, numbered by a sequence shared by all the
+// books the journal observes. Records are copied into a preallocated buffer
+// that is written out under the JournalFlushPolicy, when it fills, on sync()
+// and on close, so logging an event costs a memcpy and, for ids that are not
+// plain numbers, a hash lookup. Events must come from one thread at a time.
+//
+// Written out means handed to the OS: events survive a crash of the process
+// once written, but not a crash of the machine. What recover() can rebuild is
+// at most what was written; callers that need a command durable before they
+// acknowledge it call sync() first.
+//
+// Text ids are interned (numbered once, their text recorded). At most
+// maxInternedIds are remembered; past that the journal forgets them all and
+// interns afresh, under new numbers, ids it sees again.
+//
+// Opened with JournalOpen::Append, an existing journal is continued: its
+// sequence and ids carry on, and a partial record left by a crash is cut off
+// first. That reads the whole journal; given the checkpoint recovery ended at
+// (OrderBook::recover), a journal is continued without reading it at all.
+enum class JournalOpen {
+	Truncate,
+	Append
+};
+
+// When buffered records are written out: once this many events are buffered,
+// or once the oldest buffered one has waited interval, whichever comes first.
+// Checked as events arrive and in onIdle. An EngineRunner idles its book
+// whenever its queue is empty, so there the bound holds on a quiet book too.
+// A book driven directly must call idle() (or the journal's sync()) itself,
+// or what the journal holds waits for the next event.
+struct JournalFlushPolicy {
+	std::size_t               events = 4096;
+	std::chrono::microseconds interval{1000};
+};
+
+class EventJournal : public IOrderObserver {
+public:
+	static constexpr std::size_t defaultBufferSize = std::size_t{1} << 20;
+	static constexpr std::size_t maxInternedIds    = std::size_t{1} << 16;
+
+	// Throws std::runtime_error if the file cannot be opened, or is to be
+	// appended to but is not a journal
+	explicit EventJournal(const std::string& fileName, std::size_t bufferSize = defaultBufferSize,
+	                      JournalOpen open = JournalOpen::Truncate, JournalFlushPolicy flush = JournalFlushPolicy{});
+	// Continues the journal at `resume`, where reading it last ended (what
+	// OrderBook::recover returned), without reading it again: the file is cut
+	// back to resume.offset, which drops a torn final record. A checkpoint
+	// with no offset falls back to reading the file as JournalOpen::Append
+	// does; a missing or empty file starts a journal whose sequence and
+	// interned numbers carry on from `resume`. Throws std::runtime_error if
+	// the file cannot be opened, or is not a journal as long as resume.offset.
+	EventJournal(const std::string& fileName, const JournalCheckpoint& resume,
+	             std::size_t bufferSize = defaultBufferSize, JournalFlushPolicy flush = JournalFlushPolicy{});
+	~EventJournal() override;
+
+	EventJournal(const EventJournal&) = delete;
+	EventJournal& operator=(const EventJournal&) = delete;
+
+	void onOrderEvent(const OrderEvent& ev) override;
+	void onOrderEvents(std::span<const OrderEvent> events) override;
+	// Writes out buffered records once the oldest has waited the policy's interval
+	void onIdle() override;
+
+	// Writes out the buffer and flushes the file
+	void sync();
+	// Syncs and closes the file; events logged afterwards are ignored
+	void close();
+
+	// Sequence number of the last event recorded; 0 before the first
+	std::uint64_t getLastSequence() const { return sequence_; }
+
+	// Syncs, then returns where the journal stands, for a snapshot of the
+	// book as of its last event (OrderBook::saveSnapshot)
+	JournalCheckpoint checkpoint();
+
+private:
+	struct IdHash {
+		using is_transparent = void;
+		std::size_t operator()(std::string_view id) const { return std::hash<std::string_view>{}(id); }
+	};
+
+	using Clock = std::chrono::steady_clock;
+
+	void carryOn(const JournalCheckpoint& from);
+	void open(const std::string& fileName, bool append);
+	void append(const OrderEvent& ev, Clock::time_point now);
+	void flushIfDue(Clock::time_point now);
+	std::uint64_t idOf(std::string_view id);
+	void put(const void* record, std::size_t size);
+	void drain();
+
+	std::ofstream out_;
+	std::unique_ptr<char[]> buffer_;
+	std::size_t capacity_;
+	std::size_t used_ = 0;
+	std::uint64_t offset_ = 0;              // bytes of the file, buffered ones included
+	std::uint64_t sequence_ = 0;
+	JournalFlushPolicy flush_;
+	std::size_t pending_ = 0;               // events buffered since the last write
+	Clock::time_point oldestPending_{};
+	std::uint64_t nextInterned_ = 0;        // interned numbers are never reused
+	OrderId nextOrderId_ = 0;               // one past the largest numeric id written
+	std::unordered_map<std::string, std::uint64_t, IdHash, std::equal_to<>> interned_;
+};
@@ -1,25 +1,97 @@
-
 #pragma once
 
 #include "Interfaces/IOrderObserver.hpp"
+#include "Events/OrderEvent.hpp"
+#include "Engine/SpscQueue.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <span>
 #include <string>
-#include "Interfaces/IEvent.hpp"
+#include <thread>
 #include <vector>
-#include <memory>
 
+// Writes an event as one line of the TradeLog JSONL schema
+void writeJsonLine(std::ostream& out, const OrderEvent& ev);
+
+enum class TradeLogMode {
+	Sync,    // format and flush on the calling thread, once per call
+	Async    // hand events to a writer thread that writes and flushes in batches
+};
+
+struct TradeLogOptions {
+	TradeLogMode              mode          = TradeLogMode::Sync;
+	// Async only: events in flight between the caller and the writer
+	std::size_t               queueCapacity = std::size_t{1} << 16;
+	// Async only: flush once this many events are written, or once the
+	// oldest unflushed one has waited flushInterval, whichever comes first
+	std::size_t               flushEvents   = 4096;
+	std::chrono::microseconds flushInterval{1000};
+
+	// Events kept in memory for getEvents(): the most recent retainEvents,
+	// none if 0, or every one with allEvents (which grows without bound)
+	static constexpr std::size_t allEvents = std::numeric_limits<std::size_t>::max();
+	std::size_t               retainEvents  = 4096;
+};
+
+// Writes every order event as one JSON line.
+//
+// In async mode the observer callbacks only copy events into a lock-free
+// queue; a writer thread formats them and group-commits them under the flush
+// policy. The callbacks must then come from a single thread (the book's
+// matching thread). Nothing is dropped: a full queue makes the caller wait,
+// and close() (or the destructor) writes everything logged before returning.
 class TradeLog : public IOrderObserver {
 public:
-	TradeLog(const std::string& fileName);
+	explicit TradeLog(const std::string& fileName, TradeLogOptions options = TradeLogOptions{});
+	~TradeLog() override;
+
+	TradeLog(const TradeLog&) = delete;
+	TradeLog& operator=(const TradeLog&) = delete;
+
+	// Observer interface; a block of events is written with a single flush
+	void onOrderEvent(const OrderEvent& ev) override;
+	void onOrderEvents(std::span<const OrderEvent> events) override;
 
-	// Observer interface
-	void onOrderEvent(std::shared_ptr<IEvent> ev) override;
+	// Returns once every event logged so far has been written and flushed
+	void sync();
+	// Writes out everything logged, stops the writer and closes the file.
+	// Events logged afterwards are ignored.
+	void close();
 
-	// New: expose in-memory events
-	const std::vector<std::shared_ptr<IEvent>>& getEvents() const { return events_; }
+	// A copy of the retained events, oldest first. Safe from any thread while
+	// events are in flight; in async mode it reflects what the writer has
+	// written, which includes everything logged before the last sync().
+	std::vector<OrderEvent> getEvents() const;
 
 private:
+	void enqueue(const OrderEvent& ev);
+	void writerLoop();
+	void flush();
+	void write(const OrderEvent& ev);
+	void retain(const OrderEvent& ev);
+
+	TradeLogOptions options_;
 	std::ofstream out_;
-	std::vector<std::shared_ptr<IEvent>> events_;
-};
+	// A ring once full, eventsHead_ being the oldest event. Written by
+	// whichever thread writes the file, read by getEvents(), under eventsMutex_.
+	mutable std::mutex eventsMutex_;
+	std::vector<OrderEvent> events_;
+	std::size_t eventsHead_ = 0;
 
+	// Async mode only
+	std::unique_ptr<char[]> buffer_;
+	std::unique_ptr<SpscQueue<OrderEvent>> queue_;
+	std::uint64_t logged_ = 0;                  // caller side
+	std::uint64_t written_ = 0;                 // writer side
+	std::atomic<std::uint64_t> durable_{0};     // written and flushed
+	std::atomic<std::uint64_t> syncUpTo_{0};    // flush requested up to here
+	std::atomic<bool> stopping_{false};
+	std::thread writer_;
+};
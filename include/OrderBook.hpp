@@ -1,37 +1,102 @@
 #pragma once
+#include <cstdint>
 #include <map>
 #include <deque>
-#include <vector>
 #include <memory>
-#include <algorithm>
+#include <span>
+#include <string>
+#include <string_view>
 
+#include "Price.hpp"
 #include "Interfaces/IOrder.hpp"
+#include "Interfaces/IDepthObserver.hpp"
 #include "Interfaces/IOrderObserver.hpp"
-#include "Events/TradeEvent.hpp"
-#include "MatchingEngine.hpp"
+#include "Book/OrderPolicies.hpp"
+#include "Book/PricePolicies.hpp"
+#include "Events/JournalCheckpoint.hpp"
+#include "Observer/DynamicObservers.hpp"
+#include "BasicOrderBook.hpp"
 
-
-class OrderBook {
+// The general-purpose book: orders may be IOrder objects shared with the
+// caller, the level storage is chosen at run time, and observers register
+// through IOrderObserver. Latency-critical users with a fixed configuration
+// can instantiate BasicOrderBook directly instead.
+class OrderBook : public BasicOrderBook<SharedOrders, RuntimePrices, DynamicObservers> {
 private:
-    // two different map types: ascending for sell, descending for buy
-    std::map<double, std::deque<std::shared_ptr<IOrder>>>                   sellOrders;
-    std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>>   buyOrders;
-    std::vector<std::shared_ptr<IOrderObserver>>                             observers;
+    using Base = BasicOrderBook<SharedOrders, RuntimePrices, DynamicObservers>;
 
-    // helper to broadcast a specific event and order to all observers
-    void notifyObservers(const std::shared_ptr<IEvent>& event);
 public:
-    OrderBook() = default;
-    ~OrderBook() = default;
+    explicit OrderBook(PriceScale priceScale = PriceScale{},
+                       BookStorage storage = BookStorage::Map,
+                       std::size_t orderCapacity = OrderPool<Node>::defaultCapacity);
 
     void addObserver   (const std::shared_ptr<IOrderObserver>& observer);
     void removeObserver(const std::shared_ptr<IOrderObserver>& observer);
 
-    void addOrder   (const std::shared_ptr<IOrder>& order);
+    // Observers of the L2 deltas (see LevelUpdate); the book only tracks
+    // changed levels while one is attached
+    void addDepthObserver   (const std::shared_ptr<IDepthObserver>& observer);
+    void removeDepthObserver(const std::shared_ptr<IDepthObserver>& observer);
+
+    // Trades the order, then rests what is left under GoodTillCancel (see
+    // BasicOrderBook::addOrder); returns the quantity filled. Throws
+    // std::invalid_argument if an order with the same id is already resting,
+    // and std::length_error if a Ladder book cannot fit the price. The
+    // order's quantity is kept in step with its fills and with reductions
+    // made by modify; once modify moves the order to another price or a
+    // larger quantity, the book holds it on its own and the IOrder is left
+    // as it was.
+    int  addOrder   (const std::shared_ptr<IOrder>& order,
+                     TimeInForce timeInForce = TimeInForce::GoodTillCancel);
     void removeOrder(const std::shared_ptr<IOrder>& order);
 
+    // Pooled orders with no IOrder object behind them; see BasicOrderBook.
+    // While no observers are attached these do not allocate once warm.
+    // Observers see every order, pooled or not, as OrderEvent snapshots.
+    using Base::addOrder;
+
+    // Adds a burst of orders in order, as addOrder would, with a single
+    // observer dispatch for all their events (see applyBatch). Orders the
+    // book refuses are skipped and counted as rejected.
+    BatchResult addOrders(std::span<const std::shared_ptr<IOrder>> orders);
+
+    // Matches a resting order against the opposite side; no-op for an order
+    // that is not resting in this book
     void matchingEngine(const std::shared_ptr<IOrder>& incomingOrder);
 
-    std::map<double, std::deque<std::shared_ptr<IOrder>>> getSellOrders() const;
-    std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>> getBuyOrders() const;
+    BookStorage getStorage() const;
+
+    // Writes every resting order to a snapshot file (Book/BookSnapshot.hpp)
+    // with the checkpoint of the last journalled event the book reflects
+    // (EventJournal::checkpoint), so recovery can start reading the journal
+    // there. Given only that event's sequence, recovery reads the journal
+    // from the start. The file is synced to disk and replaced atomically.
+    // Throws std::runtime_error on I/O errors.
+    void saveSnapshot(const std::string& fileName, const JournalCheckpoint& journal) const;
+    void saveSnapshot(const std::string& fileName, std::uint64_t journalSequence) const;
+
+    // Maps a snapshot and loads it into this book, which must be empty,
+    // without raising events; returns its journal checkpoint. Throws
+    // std::runtime_error for a file that is not a snapshot or a book that is
+    // not empty, and std::invalid_argument if the tick sizes differ or the
+    // snapshot holds an order the book rejects (a repeated id); a load that
+    // fails part way leaves the book empty.
+    JournalCheckpoint loadSnapshot(const std::string& fileName);
+
+    // Rebuilds the book after a restart: loads the snapshot, if the file
+    // exists, then replays the journal events recorded after it (trades are
+    // re-derived, not replayed). With a snapshot that has a journal offset,
+    // only the journal's tail is read. The journal must be this book's
+    // alone, and observers attached meanwhile see the replayed events.
+    // Returns where the journal ends, which continues it without reading it
+    // again (EventJournal's checkpoint constructor); its sequence is the last
+    // journal event the book now reflects. Throws std::runtime_error if the
+    // journal does not continue from the snapshot's checkpoint.
+    JournalCheckpoint recover(const std::string& snapshotFile, const std::string& journalFile);
+
+    // Copies of a whole side, with an IOrder per resting order (made on the
+    // spot for orders added without one). Use forEachLevel to read the book
+    // without copying it.
+    std::map<Price, std::deque<std::shared_ptr<IOrder>>> getSellOrders() const;
+    std::map<Price, std::deque<std::shared_ptr<IOrder>>, std::greater<>> getBuyOrders() const;
 };
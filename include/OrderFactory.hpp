@@ -1,11 +1,23 @@
 #pragma once
 
+#include <memory>
+
 #include "LimitOrder.hpp"
+#include "OrderId.hpp"
+#include "Engine/BlockIdAllocator.hpp"
 
+// Creates orders with process-wide unique ids. Safe to call from any number
+// of threads: ids come from per-thread blocks (BlockIdAllocator), so they
+// increase within a thread but are not in creation order across threads.
 class OrderFactory {
     private:
-        inline static int id = 0;
+        using Ids = BlockIdAllocator<OrderFactory>;
     public:
         OrderFactory() = delete;
-        static std::shared_ptr<IOrder> createLimitOrder(int quantity, int price, OrderType orderType);
+        static std::shared_ptr<IOrder> createLimitOrder(int quantity, Price price, OrderType orderType);
+        // A fresh id for an order added to a book by number; throws
+        // std::length_error once past maxOrderId
+        static OrderId nextId();
+        // Makes later ids at least `next`, e.g. past the ids of a recovered book
+        static void skipIdsBelow(OrderId next);
 };
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <system_error>
+
+// Orders are identified by 64-bit numbers. Text ids are still accepted
+// everywhere; one that is a plain decimal number (no sign, no leading zeros,
+// at most maxOrderIdDigits digits) names the same order as that number and
+// formats back to exactly the same text.
+using OrderId = std::uint64_t;
+
+inline constexpr std::size_t maxOrderIdDigits = 18;
+inline constexpr OrderId     maxOrderId       = 999'999'999'999'999'999;   // clear of the top bit
+
+// The id as a number, if it is a plain decimal one
+inline bool parseOrderId(std::string_view id, OrderId& value) {
+    if (id.empty() || id.size() > maxOrderIdDigits || (id[0] == '0' && id.size() > 1)) {
+        return false;
+    }
+    const auto [end, ec] = std::from_chars(id.data(), id.data() + id.size(), value);
+    return ec == std::errc{} && end == id.data() + id.size();
+}
+
+// Index key of an order id given as text: the number itself for a numeric id
+// (see parseOrderId), otherwise a hash of the text with textKeyBit set, so the
+// two kinds never meet. Hashed keys are not unique; numeric ones are.
+inline constexpr OrderId textKeyBit = OrderId{1} << 63;
+
+inline OrderId orderKey(std::string_view id) {
+    OrderId value = 0;
+    if (parseOrderId(id, value)) {
+        return value;
+    }
+    return std::hash<std::string_view>{}(id) | textKeyBit;
+}
+
+// Writes the text of an id (at most maxOrderId) into out, which must hold
+// maxOrderIdDigits characters, and returns its length
+inline std::size_t formatOrderId(OrderId id, char* out) {
+    return static_cast<std::size_t>(std::to_chars(out, out + maxOrderIdDigits, id).ptr - out);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// Prices are whole numbers of ticks. Keeping them integral gives the book exact
+// key comparisons and lookups; conversion to and from decimal prices happens only
+// at the edges (CLI input, display) through the instrument's PriceScale.
+using Price = std::int64_t;
+
+class PriceScale {
+private:
+    double tickSize;
+
+public:
+    explicit PriceScale(double tickSize = 1.0);
+
+    double getTickSize() const;
+
+    // Converts a decimal price to ticks; throws std::invalid_argument when the
+    // price is not on the tick grid.
+    Price toTicks(double price) const;
+    double toDouble(Price ticks) const;
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <type_traits>
+
+#include "Stats/CycleClock.hpp"
+#include "Stats/LatencyHistogram.hpp"
+
+// Hot-path instrumentation of BasicOrderBook. Built in when ORDERBOOK_STATS
+// is 1 (CMake option ORDERBOOK_ENABLE_STATS). With 0, the default, the book
+// holds NoBookStats instead and every probe compiles to nothing. The setting
+// must be the same for every translation unit of a program.
+#ifndef ORDERBOOK_STATS
+#define ORDERBOOK_STATS 0
+#endif
+
+inline constexpr bool statsEnabled = ORDERBOOK_STATS != 0;
+
+// Add, Cancel and Modify time the whole call, observer dispatch included
+// (inside applyBatch, which dispatches once at the end, they cannot); Match
+// times the book's own matching work only
+enum class BookOperation {
+    Add,      // addOrder, including the matching it triggers
+    Cancel,   // cancel / removeOrder
+    Match,    // a matching pass (also run on its own by matchingEngine)
+    Modify    // modify, including the matching a move triggers
+};
+
+// Distribution of one measurement
+struct Percentiles {
+    std::uint64_t count = 0;
+    double        p50   = 0;
+    double        p99   = 0;
+    double        p999  = 0;
+    double        max   = 0;
+};
+
+struct BookStatsSnapshot {
+    bool        enabled    = false;   // false when built without ORDERBOOK_STATS
+    std::size_t orderCount = 0;       // resting orders after the last operation
+    Percentiles add;                  // nanoseconds
+    Percentiles cancel;               // nanoseconds
+    Percentiles match;                // nanoseconds
+    Percentiles modify;               // nanoseconds
+    Percentiles levelsWalked;         // price levels filled against, per matching pass that traded
+};
+
+// Prints a snapshot as a small table
+void dumpStats(std::ostream& out, const BookStatsSnapshot& stats);
+
+// Per-book histograms. The book's thread records; getStats() may read from
+// any thread.
+class BookStats {
+private:
+    std::array<LatencyHistogram, 4> latencies;   // by BookOperation, in ticks
+    LatencyHistogram                levels;
+    std::atomic<std::size_t>        orders{0};
+
+public:
+    static std::uint64_t start() { return CycleClock::now(); }
+
+    void finish(BookOperation operation, std::uint64_t startedAt, std::size_t orderCount) {
+        latencies[static_cast<std::size_t>(operation)].record(CycleClock::now() - startedAt);
+        orders.store(orderCount, std::memory_order_relaxed);
+    }
+
+    void levelsWalked(std::size_t count) { levels.record(count); }
+
+    BookStatsSnapshot snapshot() const;
+};
+
+// Stand-in when instrumentation is compiled out
+struct NoBookStats {
+    static std::uint64_t start() { return 0; }
+    void finish(BookOperation, std::uint64_t, std::size_t) {}
+    void levelsWalked(std::size_t) {}
+    BookStatsSnapshot snapshot() const { return {}; }
+};
+
+using ActiveBookStats = std::conditional_t<statsEnabled, BookStats, NoBookStats>;
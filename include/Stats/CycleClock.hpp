@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// The cheapest monotonic tick counter the platform has: the TSC on x86, the
+// virtual counter on ARM64, steady_clock nanoseconds elsewhere. Meant for
+// timing short intervals on one thread; convert with nanosPerTick().
+struct CycleClock {
+    static std::uint64_t now() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t ticks;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // Length of one tick, measured against steady_clock the first time it is
+    // asked for (which takes a few milliseconds)
+    static double nanosPerTick();
+};
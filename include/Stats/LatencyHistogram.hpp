@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+// Log-linear (HDR-style) histogram of non-negative integer samples: values
+// below 32 are counted exactly, larger ones in 32 sub-buckets per power of
+// two, so any recorded value is reported within about 3%. Fixed size, no
+// allocation.
+//
+// One thread records; any thread may read at the same time. Counters are
+// relaxed atomics written only by the recording thread, so recording costs
+// no locked instructions and a reader sees a slightly stale but usable view.
+class LatencyHistogram {
+public:
+    static constexpr unsigned    subBucketBits = 5;
+    static constexpr std::size_t subBuckets    = std::size_t{1} << subBucketBits;
+    static constexpr std::size_t bucketCount   = (64 - subBucketBits + 1) * subBuckets;
+
+private:
+    std::array<std::atomic<std::uint64_t>, bucketCount> counts{};
+    std::atomic<std::uint64_t>                          total{0};
+    std::atomic<std::uint64_t>                          maximum{0};
+
+    static void bump(std::atomic<std::uint64_t>& counter) {
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+public:
+    static std::size_t bucketOf(std::uint64_t value) {
+        const unsigned msb = 63 - static_cast<unsigned>(std::countl_zero(value | 1));
+        if (msb < subBucketBits) {
+            return static_cast<std::size_t>(value);
+        }
+        const unsigned shift = msb - subBucketBits;
+        return (shift + 1) * subBuckets + static_cast<std::size_t>((value >> shift) - subBuckets);
+    }
+
+    // The largest value that falls in a bucket
+    static std::uint64_t bucketTop(std::size_t bucket) {
+        if (bucket < subBuckets) {
+            return bucket;
+        }
+        const std::size_t shift = bucket / subBuckets - 1;
+        const std::uint64_t bottom = static_cast<std::uint64_t>(subBuckets + bucket % subBuckets) << shift;
+        return bottom + ((std::uint64_t{1} << shift) - 1);
+    }
+
+    // Recording thread only
+    void record(std::uint64_t value) {
+        bump(counts[bucketOf(value)]);
+        bump(total);
+        if (value > maximum.load(std::memory_order_relaxed)) {
+            maximum.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t count() const { return total.load(std::memory_order_relaxed); }
+    std::uint64_t max()   const { return maximum.load(std::memory_order_relaxed); }
+
+    // The value at or below which `quantile` (0..1) of the samples fall,
+    // rounded up to its bucket's top and capped at the largest sample; 0 if
+    // nothing was recorded
+    std::uint64_t percentile(double quantile) const {
+        std::uint64_t samples = 0;
+        for (const auto& c : counts) samples += c.load(std::memory_order_relaxed);
+        if (samples == 0) {
+            return 0;
+        }
+
+        const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(quantile * static_cast<double>(samples) + 0.5));
+        std::uint64_t seen = 0;
+        for (std::size_t b = 0; b < bucketCount; ++b) {
+            seen += counts[b].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                return std::min(bucketTop(b), max());
+            }
+        }
+        return max();
+    }
+};
@@ -0,0 +1,343 @@
+#include "OrderBook.hpp"
+#include "Book/BookSnapshot.hpp"
+#include "Events/JournalReader.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    // A whole file read into memory; Windows has no mmap, and snapshots are
+    // only loaded at startup
+    class MappedFile {
+    private:
+        std::vector<char> data;
+
+    public:
+        explicit MappedFile(const std::string& fileName) {
+            std::ifstream in(fileName, std::ios::binary | std::ios::ate);
+            if (!in) {
+                throw std::runtime_error("OrderBook: cannot open snapshot " + fileName);
+            }
+            data.resize(static_cast<std::size_t>(in.tellg()));
+            in.seekg(0);
+            if (!in.read(data.data(), static_cast<std::streamsize>(data.size()))) {
+                throw std::runtime_error("OrderBook: cannot read snapshot " + fileName);
+            }
+        }
+
+        const char* bytes() const { return data.data(); }
+        std::size_t size()  const { return data.size(); }
+    };
+
+    // Forces a written file to stable storage
+    bool syncFile(const std::string& fileName) {
+        const int fd = ::_open(fileName.c_str(), _O_RDWR | _O_BINARY);
+        if (fd < 0) {
+            return false;
+        }
+        const bool synced = ::_commit(fd) == 0;
+        ::_close(fd);
+        return synced;
+    }
+
+    // Renames on NTFS are journalled by the file system itself
+    bool syncDirectoryOf(const std::string&) { return true; }
+#else
+    // Read-only mapping of a whole file
+    class MappedFile {
+    private:
+        void*       data = MAP_FAILED;
+        std::size_t length = 0;
+
+    public:
+        explicit MappedFile(const std::string& fileName) {
+            const int fd = ::open(fileName.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("OrderBook: cannot open snapshot " + fileName);
+            }
+            struct stat info{};
+            if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+                length = static_cast<std::size_t>(info.st_size);
+                data   = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            }
+            ::close(fd);
+            if (data == MAP_FAILED) {
+                throw std::runtime_error("OrderBook: cannot map snapshot " + fileName);
+            }
+            ::madvise(data, length, MADV_SEQUENTIAL);
+        }
+        ~MappedFile() { ::munmap(data, length); }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        const char* bytes() const { return static_cast<const char*>(data); }
+        std::size_t size()  const { return length; }
+    };
+
+    // Forces a written file, or a directory's entries, to stable storage
+    bool syncPath(const std::string& path, int flags) {
+        const int fd = ::open(path.c_str(), flags);
+        if (fd < 0) {
+            return false;
+        }
+        const bool synced = ::fsync(fd) == 0;
+        ::close(fd);
+        return synced;
+    }
+
+    bool syncFile(const std::string& fileName) { return syncPath(fileName, O_RDONLY); }
+
+    // So that a rename into the directory survives a machine crash too
+    bool syncDirectoryOf(const std::string& fileName) {
+        const std::filesystem::path parent = std::filesystem::path(fileName).parent_path();
+        return syncPath(parent.empty() ? std::string(".") : parent.string(), O_RDONLY | O_DIRECTORY);
+    }
+#endif
+
+    std::int64_t toNs(std::chrono::system_clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+
+    std::chrono::system_clock::time_point fromNs(std::int64_t ns) {
+        return std::chrono::system_clock::time_point{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{ns})};
+    }
+
+    // Appends one side's levels and orders, in priority order
+    template <typename Levels>
+    void collect(const Levels& levels, std::vector<SnapshotLevel>& outLevels, std::vector<SnapshotOrder>& outOrders) {
+        levels.forEach([&](Price price, const auto& level) {
+            SnapshotLevel& l = outLevels.emplace_back();
+            l.price = price;
+            level.forEach([&](const SharedOrders::Node& node) {
+                SnapshotOrder& o = outOrders.emplace_back();
+                o.timestampNs = toNs(node.timestamp);
+                o.quantity    = node.quantity;
+                char digits[maxOrderIdDigits];
+                const std::string_view id = node.getId(digits);
+                o.idLength    = static_cast<std::uint8_t>(id.size());
+                std::memcpy(o.id, id.data(), id.size());
+                l.side = static_cast<std::uint8_t>(node.side);
+                ++l.orderCount;
+            });
+        });
+    }
+}
+
+void OrderBook::saveSnapshot(const std::string& fileName, std::uint64_t journalSequence) const {
+    JournalCheckpoint journal;
+    journal.sequence = journalSequence;
+    saveSnapshot(fileName, journal);
+}
+
+void OrderBook::saveSnapshot(const std::string& fileName, const JournalCheckpoint& journal) const {
+    std::vector<SnapshotLevel> levels;
+    std::vector<SnapshotOrder> orders;
+    orders.reserve(getOrderCount());
+    visitSides([&](const auto& s) {
+        collect(s.sellOrders, levels, orders);
+        collect(s.buyOrders, levels, orders);
+    });
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, snapshotMagic, sizeof(header.magic));
+    header.version         = snapshotVersion;
+    header.journalSequence = journal.sequence;
+    header.levelCount      = levels.size();
+    header.orderCount      = orders.size();
+    header.tickSize        = getPriceScale().getTickSize();
+
+    SnapshotJournal tail{};
+    tail.offset        = journal.offset;
+    tail.nextInterned  = journal.nextInterned;
+    tail.nextOrderId   = journal.nextOrderId;
+    tail.internedCount = journal.internedIds.size();
+    std::vector<SnapshotInternedId> interned;
+    interned.reserve(journal.internedIds.size());
+    for (const auto& [value, id] : journal.internedIds) {
+        SnapshotInternedId& record = interned.emplace_back();
+        record.orderId  = value;
+        record.idLength = static_cast<std::uint8_t>(std::min(id.size(), sizeof(record.id)));
+        std::memcpy(record.id, id.data(), record.idLength);
+    }
+
+    // Written aside, forced to disk and renamed into place, so a crash of
+    // the process or the machine leaves either the old snapshot or the new
+    // one, never a torn one
+    const std::string partial = fileName + ".tmp";
+    {
+        std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(&tail), sizeof(tail));
+        out.write(reinterpret_cast<const char*>(levels.data()), static_cast<std::streamsize>(levels.size() * sizeof(SnapshotLevel)));
+        out.write(reinterpret_cast<const char*>(orders.data()), static_cast<std::streamsize>(orders.size() * sizeof(SnapshotOrder)));
+        out.write(reinterpret_cast<const char*>(interned.data()), static_cast<std::streamsize>(interned.size() * sizeof(SnapshotInternedId)));
+        out.flush();
+        if (!out) {
+            std::remove(partial.c_str());
+            throw std::runtime_error("OrderBook: cannot write snapshot " + partial);
+        }
+    }
+    if (!syncFile(partial)) {
+        std::remove(partial.c_str());
+        throw std::runtime_error("OrderBook: cannot sync snapshot " + partial);
+    }
+    std::error_code ec;
+    std::filesystem::rename(partial, fileName, ec);
+    if (ec) {
+        std::remove(partial.c_str());
+        throw std::runtime_error("OrderBook: cannot replace snapshot " + fileName + ": " + ec.message());
+    }
+    if (!syncDirectoryOf(fileName)) {
+        throw std::runtime_error("OrderBook: cannot sync the directory of snapshot " + fileName);
+    }
+}
+
+JournalCheckpoint OrderBook::loadSnapshot(const std::string& fileName) {
+    if (getOrderCount() != 0) {
+        throw std::runtime_error("OrderBook: snapshots load into an empty book only");
+    }
+
+    const MappedFile file{fileName};
+    SnapshotHeader header;
+    if (file.size() < sizeof(header)) {
+        throw std::runtime_error("OrderBook: not a snapshot: " + fileName);
+    }
+    std::memcpy(&header, file.bytes(), sizeof(header));
+    if (std::memcmp(header.magic, snapshotMagic, sizeof(header.magic)) != 0 ||
+        (header.version != snapshotVersion && header.version != 1)) {
+        throw std::runtime_error("OrderBook: not a snapshot: " + fileName);
+    }
+    // Version 1 has no journal checkpoint beyond the sequence
+    SnapshotJournal tail{};
+    std::size_t tailSize = 0;
+    if (header.version != 1) {
+        tailSize = sizeof(tail);
+        if (file.size() < sizeof(header) + tailSize) {
+            throw std::runtime_error("OrderBook: not a snapshot: " + fileName);
+        }
+        std::memcpy(&tail, file.bytes() + sizeof(header), sizeof(tail));
+    }
+    if (file.size() != sizeof(header) + tailSize + header.levelCount * sizeof(SnapshotLevel) +
+                       header.orderCount * sizeof(SnapshotOrder) + tail.internedCount * sizeof(SnapshotInternedId)) {
+        throw std::runtime_error("OrderBook: not a snapshot: " + fileName);
+    }
+    if (header.tickSize != getPriceScale().getTickSize()) {
+        throw std::invalid_argument("OrderBook: snapshot tick size differs from the book's");
+    }
+
+    const char* levelBytes    = file.bytes() + sizeof(header) + tailSize;
+    const char* orderBytes    = levelBytes + header.levelCount * sizeof(SnapshotLevel);
+    const char* internedBytes = orderBytes + header.orderCount * sizeof(SnapshotOrder);
+    reserveOrders(header.orderCount);
+
+    std::uint64_t next = 0;
+    try {
+        for (std::uint64_t l = 0; l < header.levelCount; ++l) {
+            SnapshotLevel level;
+            std::memcpy(&level, levelBytes + l * sizeof(SnapshotLevel), sizeof(level));
+            if (level.orderCount > header.orderCount - next) {
+                throw std::runtime_error("OrderBook: corrupt snapshot " + fileName);
+            }
+            for (std::uint32_t i = 0; i < level.orderCount; ++i, ++next) {
+                SnapshotOrder order;
+                std::memcpy(&order, orderBytes + next * sizeof(SnapshotOrder), sizeof(order));
+
+                Node& node = acquireNode();
+                assignId(node, std::string_view(order.id, std::min<std::size_t>(order.idLength, sizeof(order.id))));
+                node.price     = level.price;
+                node.quantity  = order.quantity;
+                node.side      = static_cast<OrderType>(level.side);
+                node.timestamp = fromNs(order.timestampNs);
+                restore(node);
+            }
+        }
+    } catch (...) {
+        // All or nothing: the book goes back to empty
+        discardAll();
+        throw;
+    }
+
+    JournalCheckpoint journal{header.journalSequence, tail.offset, tail.nextInterned, tail.nextOrderId, {}};
+    journal.internedIds.reserve(tail.internedCount);
+    for (std::uint64_t i = 0; i < tail.internedCount; ++i) {
+        SnapshotInternedId id;
+        std::memcpy(&id, internedBytes + i * sizeof(SnapshotInternedId), sizeof(id));
+        journal.internedIds.emplace(id.orderId, std::string(id.id, std::min<std::size_t>(id.idLength, sizeof(id.id))));
+    }
+    return journal;
+}
+
+JournalCheckpoint OrderBook::recover(const std::string& snapshotFile, const std::string& journalFile) {
+    JournalCheckpoint from;
+    if (std::filesystem::exists(snapshotFile)) {
+        from = loadSnapshot(snapshotFile);
+    }
+    if (!std::filesystem::exists(journalFile)) {
+        // Nothing to read on from; a new journal carries on the numbering
+        from.offset = 0;
+        from.internedIds.clear();
+        return from;
+    }
+
+    // Replayed orders and events keep the times they were journalled with
+    const ScopedClock<OrderBook> journalTime{*this, EngineClock{ClockSource::Simulated}};
+    // Straight to the tail where the snapshot says it starts; without an
+    // offset, from the start, skipping what the snapshot already holds
+    const bool tailOnly = from.offset != 0;
+    JournalReader journal = tailOnly ? JournalReader{journalFile, from} : JournalReader{journalFile};
+    std::uint64_t sequence = from.sequence;
+    bool first = true;
+    OrderEvent ev;
+    while (journal.next(ev)) {
+        if (tailOnly && first && ev.sequence != from.sequence + 1) {
+            throw std::runtime_error("OrderBook: journal " + journalFile + " does not continue from the snapshot");
+        }
+        first = false;
+        if (ev.sequence <= sequence) {
+            continue;
+        }
+        sequence = ev.sequence;
+        getClock().set(ev.timestamp);
+        switch (ev.type) {
+          case OrderEventType::ADD:
+            addOrder(ev.order.getId(), ev.order.side, ev.order.price, ev.order.quantity);
+            break;
+          case OrderEventType::REMOVE:
+            cancel(ev.order.getId());
+            break;
+          case OrderEventType::MODIFY:
+            modify(ev.order.getId(), ev.order.quantity, ev.order.price);
+            break;
+          case OrderEventType::MATCH:
+            // Re-derived by the ADD that caused it
+            break;
+        }
+    }
+
+    JournalCheckpoint end = journal.position();
+    end.sequence     = sequence;
+    end.nextInterned = std::max(end.nextInterned, from.nextInterned);
+    end.nextOrderId  = std::max(end.nextOrderId, from.nextOrderId);
+    return end;
+}
@@ -0,0 +1,76 @@
+#include "Stats/BookStats.hpp"
+#include "Stats/CycleClock.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <thread>
+
+double CycleClock::nanosPerTick() {
+    static const double nanos = [] {
+        using Clock = std::chrono::steady_clock;
+        const auto wallStart = Clock::now();
+        const std::uint64_t tickStart = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        const std::uint64_t ticks = now() - tickStart;
+        const double wall = std::chrono::duration<double, std::nano>(Clock::now() - wallStart).count();
+        return ticks > 0 ? wall / static_cast<double>(ticks) : 1.0;
+    }();
+    return nanos;
+}
+
+namespace {
+    Percentiles summarize(const LatencyHistogram& histogram, double scale) {
+        Percentiles p;
+        p.count = histogram.count();
+        p.p50   = static_cast<double>(histogram.percentile(0.50))  * scale;
+        p.p99   = static_cast<double>(histogram.percentile(0.99))  * scale;
+        p.p999  = static_cast<double>(histogram.percentile(0.999)) * scale;
+        p.max   = static_cast<double>(histogram.max()) * scale;
+        return p;
+    }
+
+    void row(std::ostream& out, const char* name, const Percentiles& p) {
+        out << std::left << std::setw(15) << name << std::right
+            << std::setw(10) << p.count
+            << std::setw(10) << p.p50
+            << std::setw(10) << p.p99
+            << std::setw(10) << p.p999
+            << std::setw(10) << p.max << "\n";
+    }
+}
+
+BookStatsSnapshot BookStats::snapshot() const {
+    const double ns = CycleClock::nanosPerTick();
+    BookStatsSnapshot s;
+    s.enabled      = true;
+    s.orderCount   = orders.load(std::memory_order_relaxed);
+    s.add          = summarize(latencies[static_cast<std::size_t>(BookOperation::Add)], ns);
+    s.cancel       = summarize(latencies[static_cast<std::size_t>(BookOperation::Cancel)], ns);
+    s.match        = summarize(latencies[static_cast<std::size_t>(BookOperation::Match)], ns);
+    s.modify       = summarize(latencies[static_cast<std::size_t>(BookOperation::Modify)], ns);
+    s.levelsWalked = summarize(levels, 1.0);
+    return s;
+}
+
+void dumpStats(std::ostream& out, const BookStatsSnapshot& stats) {
+    if (!stats.enabled) {
+        out << "Statistics are not built in (ORDERBOOK_STATS=0)\n";
+        return;
+    }
+
+    const auto flags = out.flags();
+    const auto precision = out.precision();
+    out << std::fixed << std::setprecision(0)
+        << "resting orders " << stats.orderCount << "\n"
+        << std::left << std::setw(15) << "operation (ns)" << std::right
+        << std::setw(10) << "count" << std::setw(10) << "p50" << std::setw(10) << "p99"
+        << std::setw(10) << "p99.9" << std::setw(10) << "max" << "\n";
+    row(out, "add", stats.add);
+    row(out, "cancel", stats.cancel);
+    row(out, "match", stats.match);
+    row(out, "modify", stats.modify);
+    row(out, "levels/match", stats.levelsWalked);
+    out.flags(flags);
+    out.precision(precision);
+}
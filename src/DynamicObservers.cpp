@@ -0,0 +1,44 @@
+#include "Observer/DynamicObservers.hpp"
+
+#include <algorithm>
+
+
+void DynamicObservers::add(const std::shared_ptr<IOrderObserver>& observer) {
+    observers.push_back(observer);
+}
+
+void DynamicObservers::remove(const std::shared_ptr<IOrderObserver>& observer) {
+    observers.erase(
+        std::ranges::remove(observers, observer).begin(),
+        observers.end()
+    );
+}
+
+void DynamicObservers::addDepth(const std::shared_ptr<IDepthObserver>& observer) {
+    depthObservers.push_back(observer);
+}
+
+void DynamicObservers::removeDepth(const std::shared_ptr<IDepthObserver>& observer) {
+    depthObservers.erase(
+        std::ranges::remove(depthObservers, observer).begin(),
+        depthObservers.end()
+    );
+}
+
+void DynamicObservers::onEvents(std::span<const OrderEvent> events) {
+    for (const auto& obs : observers) {
+        obs->onOrderEvents(events);
+    }
+}
+
+void DynamicObservers::onIdle() {
+    for (const auto& obs : observers) {
+        obs->onIdle();
+    }
+}
+
+void DynamicObservers::onLevelUpdates(std::span<const LevelUpdate> updates) {
+    for (const auto& obs : depthObservers) {
+        obs->onLevelUpdates(updates);
+    }
+}
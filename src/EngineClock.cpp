@@ -0,0 +1,12 @@
+#include "Engine/EngineClock.hpp"
+
+void TscClock::reanchor() {
+    if (reanchorTicks == 0) {
+        nanosPerTick  = CycleClock::nanosPerTick();
+        reanchorTicks = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(
+            std::chrono::duration<double, std::nano>(reanchorInterval).count() / nanosPerTick));
+    }
+    anchorTicks = CycleClock::now();
+    anchor      = std::chrono::system_clock::now();
+    last        = std::max(last, anchor);
+}
@@ -0,0 +1,224 @@
+#include "Observer/EventJournal.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include "OrderId.hpp"
+#include "Events/JournalReader.hpp"
+
+namespace {
+    std::size_t bufferCapacity(std::size_t bufferSize) {
+        return std::max(bufferSize, sizeof(JournalEventRecord) + sizeof(JournalIdRecord));
+    }
+
+    bool hasContent(const std::string& fileName) {
+        return std::filesystem::exists(fileName) && std::filesystem::file_size(fileName) > 0;
+    }
+
+    // Reads an existing journal to its end, minus any torn final record,
+    // which is cut off
+    JournalCheckpoint scanToEnd(const std::string& fileName) {
+        JournalReader reader{fileName};
+        OrderEvent ev;
+        while (reader.next(ev)) {
+        }
+        std::filesystem::resize_file(fileName, reader.validLength());
+        return reader.position();
+    }
+}
+
+EventJournal::EventJournal(const std::string& fileName, std::size_t bufferSize, JournalOpen open,
+                           JournalFlushPolicy flush)
+  : buffer_(std::make_unique<char[]>(bufferCapacity(bufferSize)))
+  , capacity_(bufferCapacity(bufferSize))
+  , flush_(flush)
+{
+    const bool append = open == JournalOpen::Append && hasContent(fileName);
+    if (append) {
+        // Ids interned before are interned again on first use, under new
+        // numbers
+        const JournalCheckpoint end = scanToEnd(fileName);
+        offset_ = end.offset;
+        carryOn(end);
+    }
+    this->open(fileName, append);
+}
+
+EventJournal::EventJournal(const std::string& fileName, const JournalCheckpoint& resume, std::size_t bufferSize,
+                           JournalFlushPolicy flush)
+  : buffer_(std::make_unique<char[]>(bufferCapacity(bufferSize)))
+  , capacity_(bufferCapacity(bufferSize))
+  , flush_(flush)
+{
+    const bool append = hasContent(fileName);
+    if (append && resume.offset == 0) {
+        const JournalCheckpoint end = scanToEnd(fileName);
+        offset_ = end.offset;
+        carryOn(end);
+    } else if (append) {
+        if (!JournalReader::isJournal(fileName) || std::filesystem::file_size(fileName) < resume.offset) {
+            throw std::runtime_error("EventJournal: " + fileName + " does not match its checkpoint");
+        }
+        std::filesystem::resize_file(fileName, resume.offset);
+        offset_ = resume.offset;
+    }
+    carryOn(resume);
+    open(fileName, append);
+}
+
+void EventJournal::carryOn(const JournalCheckpoint& from) {
+    sequence_     = std::max(sequence_, from.sequence);
+    nextInterned_ = std::max(nextInterned_, from.nextInterned);
+    nextOrderId_  = std::max(nextOrderId_, from.nextOrderId);
+}
+
+void EventJournal::open(const std::string& fileName, bool append) {
+    // The journal does its own buffering
+    out_.rdbuf()->pubsetbuf(nullptr, 0);
+    out_.open(fileName, std::ios::binary | (append ? std::ios::app : std::ios::trunc));
+    if (!out_) {
+        throw std::runtime_error("EventJournal: cannot open " + fileName);
+    }
+    if (append) {
+        return;
+    }
+
+    JournalFileHeader header{};
+    std::memcpy(header.magic, journalMagic, sizeof(header.magic));
+    header.version = journalVersion;
+    put(&header, sizeof(header));
+    // A new journal is readable (if empty) from the start
+    sync();
+}
+
+EventJournal::~EventJournal() {
+    close();
+}
+
+void EventJournal::onOrderEvent(const OrderEvent& ev) {
+    if (!out_.is_open()) return;
+    const auto now = Clock::now();
+    append(ev, now);
+    flushIfDue(now);
+}
+
+void EventJournal::onOrderEvents(std::span<const OrderEvent> events) {
+    if (!out_.is_open()) return;
+    const auto now = Clock::now();
+    for (const auto& ev : events) {
+        append(ev, now);
+    }
+    flushIfDue(now);
+}
+
+void EventJournal::onIdle() {
+    if (pending_ > 0) {
+        flushIfDue(Clock::now());
+    }
+}
+
+void EventJournal::sync() {
+    if (!out_.is_open()) return;
+    drain();
+    out_.flush();
+}
+
+JournalCheckpoint EventJournal::checkpoint() {
+    sync();
+    JournalCheckpoint at{sequence_, offset_, nextInterned_, nextOrderId_, {}};
+    at.internedIds.reserve(interned_.size());
+    for (const auto& [id, value] : interned_) {
+        at.internedIds.emplace(value, id);
+    }
+    return at;
+}
+
+void EventJournal::close() {
+    if (!out_.is_open()) return;
+    sync();
+    out_.close();
+}
+
+void EventJournal::flushIfDue(Clock::time_point now) {
+    if (pending_ >= flush_.events || (pending_ > 0 && now - oldestPending_ >= flush_.interval)) {
+        sync();
+    }
+}
+
+void EventJournal::append(const OrderEvent& ev, Clock::time_point now) {
+    JournalEventRecord record{};
+    record.length      = sizeof(record);
+    record.sequence    = ++sequence_;
+    record.timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(ev.timestamp.time_since_epoch()).count();
+    record.orderId     = idOf(ev.order.getId());
+
+    switch (ev.type) {
+      case OrderEventType::ADD:
+      case OrderEventType::REMOVE:
+      case OrderEventType::MODIFY:
+        record.type     = ev.type == OrderEventType::ADD    ? JournalRecordType::Add
+                        : ev.type == OrderEventType::REMOVE ? JournalRecordType::Remove
+                                                            : JournalRecordType::Modify;
+        record.side     = static_cast<std::uint8_t>(ev.order.side);
+        record.price    = ev.order.price;
+        record.quantity = ev.quantity;
+        break;
+      case OrderEventType::MATCH:
+        record.type     = JournalRecordType::Match;
+        record.side     = static_cast<std::uint8_t>(OrderType::BUY);
+        record.contraId = idOf(ev.sellOrder().getId());
+        record.price    = ev.buyOrder().price;
+        record.quantity = ev.quantity;
+        break;
+    }
+    put(&record, sizeof(record));
+    if (pending_++ == 0) {
+        oldestPending_ = now;
+    }
+}
+
+// Numeric ids (see parseOrderId) map to themselves, clear of internedIdBit;
+// any other id is numbered the first time it is seen (or first seen since the
+// interned ids were last forgotten), and its text recorded
+std::uint64_t EventJournal::idOf(std::string_view id) {
+    OrderId value = 0;
+    if (parseOrderId(id, value)) {
+        nextOrderId_ = std::max(nextOrderId_, value + 1);
+        return value;
+    }
+    if (auto it = interned_.find(id); it != interned_.end()) {
+        return it->second;
+    }
+
+    if (interned_.size() >= maxInternedIds) {
+        interned_.clear();
+    }
+    value = internedIdBit | nextInterned_++;
+    interned_.emplace(std::string(id), value);
+
+    JournalIdRecord record{};
+    record.length   = sizeof(record);
+    record.type     = JournalRecordType::Id;
+    record.idLength = static_cast<std::uint8_t>(std::min(id.size(), sizeof(record.id)));
+    record.orderId  = value;
+    std::memcpy(record.id, id.data(), record.idLength);
+    put(&record, sizeof(record));
+    return value;
+}
+
+void EventJournal::put(const void* record, std::size_t size) {
+    if (used_ + size > capacity_) {
+        drain();
+    }
+    std::memcpy(buffer_.get() + used_, record, size);
+    used_   += size;
+    offset_ += size;
+}
+
+void EventJournal::drain() {
+    out_.write(buffer_.get(), static_cast<std::streamsize>(used_));
+    used_    = 0;
+    pending_ = 0;
+}
@@ -0,0 +1,146 @@
+#include "Events/JournalReader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+    bool readHeader(std::ifstream& in, JournalFileHeader& header) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&header), sizeof(header))) &&
+               std::memcmp(header.magic, journalMagic, sizeof(header.magic)) == 0;
+    }
+}
+
+JournalReader::JournalReader(const std::string& fileName)
+  : in_(fileName, std::ios::binary)
+{
+    if (!in_) {
+        throw std::runtime_error("JournalReader: cannot open " + fileName);
+    }
+    JournalFileHeader header{};
+    if (!readHeader(in_, header)) {
+        throw std::runtime_error("JournalReader: not a journal: " + fileName);
+    }
+    if (header.version != journalVersion) {
+        throw std::runtime_error("JournalReader: unsupported journal version " + std::to_string(header.version));
+    }
+    validLength_ = sizeof(header);
+}
+
+JournalReader::JournalReader(const std::string& fileName, const JournalCheckpoint& from)
+  : JournalReader(fileName)
+{
+    if (from.offset < validLength_) {
+        return;
+    }
+    in_.seekg(0, std::ios::end);
+    if (static_cast<std::uint64_t>(in_.tellg()) < from.offset) {
+        throw std::runtime_error("JournalReader: " + fileName + " is shorter than its checkpoint");
+    }
+    in_.seekg(static_cast<std::streamoff>(from.offset));
+    validLength_  = from.offset;
+    sequence_     = from.sequence;
+    nextInterned_ = from.nextInterned;
+    nextOrderId_  = from.nextOrderId;
+    interned_     = from.internedIds;
+}
+
+JournalCheckpoint JournalReader::position() const {
+    return JournalCheckpoint{sequence_, validLength_, nextInterned_, nextOrderId_, interned_};
+}
+
+// Keeps the next free numbers past an id read
+void JournalReader::see(std::uint64_t id) {
+    if ((id & internedIdBit) != 0) {
+        nextInterned_ = std::max(nextInterned_, (id & ~internedIdBit) + 1);
+    } else {
+        nextOrderId_ = std::max(nextOrderId_, id + 1);
+    }
+}
+
+bool JournalReader::isJournal(const std::string& fileName) {
+    std::ifstream in(fileName, std::ios::binary);
+    JournalFileHeader header{};
+    return in && readHeader(in, header);
+}
+
+std::string JournalReader::idText(std::uint64_t id) const {
+    if ((id & internedIdBit) == 0) {
+        return std::to_string(id);
+    }
+    const auto it = interned_.find(id);
+    if (it == interned_.end()) {
+        throw std::runtime_error("JournalReader: undefined order id " + std::to_string(id));
+    }
+    return it->second;
+}
+
+bool JournalReader::next(OrderEvent& event) {
+    // Both record types have the same size; the length prefix still decides
+    // how much to consume, so unknown (larger) records are skipped
+    char raw[sizeof(JournalEventRecord)];
+    while (true) {
+        std::uint16_t length = 0;
+        if (!in_.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+            truncated_ = in_.gcount() != 0;
+            return false;
+        }
+        if (length < sizeof(JournalEventRecord)) {
+            throw std::runtime_error("JournalReader: corrupt record length " + std::to_string(length));
+        }
+        std::memcpy(raw, &length, sizeof(length));
+        if (!in_.read(raw + sizeof(length), sizeof(raw) - sizeof(length)) ||
+            !in_.ignore(length - sizeof(raw)) || in_.gcount() != length - static_cast<std::streamsize>(sizeof(raw))) {
+            truncated_ = true;
+            return false;
+        }
+        validLength_ += length;
+
+        JournalEventRecord record;
+        std::memcpy(&record, raw, sizeof(record));
+        switch (record.type) {
+          case JournalRecordType::Id: {
+            JournalIdRecord id;
+            std::memcpy(&id, raw, sizeof(id));
+            interned_[id.orderId].assign(id.id, std::min<std::size_t>(id.idLength, sizeof(id.id)));
+            see(id.orderId);
+            continue;
+          }
+          case JournalRecordType::Add:
+          case JournalRecordType::Remove:
+          case JournalRecordType::Match:
+          case JournalRecordType::Modify:
+            break;
+          default:
+            continue;
+        }
+
+        sequence_ = record.sequence;
+        see(record.orderId);
+        if (record.type == JournalRecordType::Match) {
+            see(record.contraId);
+        }
+
+        event = OrderEvent{};
+        event.sequence  = record.sequence;
+        event.timestamp = std::chrono::system_clock::time_point{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds{record.timestampNs})};
+        event.quantity  = record.quantity;
+        event.order.setId(idText(record.orderId));
+        event.order.side  = static_cast<OrderType>(record.side);
+        event.order.price = record.price;
+
+        if (record.type == JournalRecordType::Match) {
+            event.type = OrderEventType::MATCH;
+            event.contra.setId(idText(record.contraId));
+            event.contra.side  = OrderType::SELL;
+            event.contra.price = record.price;
+        } else {
+            event.type = record.type == JournalRecordType::Add    ? OrderEventType::ADD
+                       : record.type == JournalRecordType::Remove ? OrderEventType::REMOVE
+                                                                  : OrderEventType::MODIFY;
+            event.order.quantity = record.quantity;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,116 @@
+#include "Events/JsonlReader.hpp"
+#include <charconv>
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+
+namespace {
+    // The raw value of "key" in a flat JSON object: a string's contents
+    // without the quotes, or a number's text. Empty if the key is missing.
+    std::string_view field(std::string_view line, std::string_view key) {
+        std::size_t at = 0;
+        while ((at = line.find(key, at)) != std::string_view::npos) {
+            const bool quoted = at > 0 && line[at - 1] == '"' && at + key.size() < line.size() &&
+                                line[at + key.size()] == '"';
+            at += key.size();
+            if (!quoted) continue;
+
+            std::size_t i = line.find_first_not_of(" \t", at + 1);
+            if (i == std::string_view::npos || line[i] != ':') continue;
+            i = line.find_first_not_of(" \t", i + 1);
+            if (i == std::string_view::npos) return {};
+            if (line[i] == '"') {
+                const std::size_t end = line.find('"', i + 1);
+                return end == std::string_view::npos ? std::string_view{} : line.substr(i + 1, end - i - 1);
+            }
+            const std::size_t end = line.find_first_of(",} \t", i);
+            return line.substr(i, end == std::string_view::npos ? std::string_view::npos : end - i);
+        }
+        return {};
+    }
+
+    template <typename T>
+    bool parseNumber(std::string_view text, T& value) {
+        const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        return !text.empty() && ec == std::errc{} && end == text.data() + text.size();
+    }
+
+    bool parseSide(std::string_view text, OrderType& side) {
+        if (text == "BUY")  { side = OrderType::BUY;  return true; }
+        if (text == "SELL") { side = OrderType::SELL; return true; }
+        return false;
+    }
+}
+
+JsonlReader::JsonlReader(const std::string& fileName)
+  : in_(fileName)
+{
+    if (!in_) {
+        throw std::runtime_error("JsonlReader: cannot open " + fileName);
+    }
+}
+
+bool JsonlReader::next(OrderEvent& event) {
+    while (std::getline(in_, line_)) {
+        ++lineNumber_;
+        const std::string_view line{line_};
+        if (line.find_first_not_of(" \t\r") == std::string_view::npos) {
+            continue;
+        }
+
+        event = OrderEvent{};
+        const std::string_view type = field(line, "type");
+        std::int64_t ms = 0;
+        bool ok = parseNumber(field(line, "timestamp"), ms);
+
+        if (type == "add") {
+            event.type = OrderEventType::ADD;
+            const std::string_view id = field(line, "order_id");
+            ok = ok && !id.empty() && id.size() <= OrderSnapshot::maxIdLength &&
+                 parseSide(field(line, "side"), event.order.side) &&
+                 parseNumber(field(line, "price"), event.order.price) &&
+                 parseNumber(field(line, "quantity"), event.order.quantity);
+            event.order.setId(id);
+            event.quantity = event.order.quantity;
+        } else if (type == "cancel") {
+            event.type = OrderEventType::REMOVE;
+            const std::string_view id = field(line, "order_id");
+            ok = ok && !id.empty() && id.size() <= OrderSnapshot::maxIdLength &&
+                 parseSide(field(line, "side"), event.order.side);
+            event.order.setId(id);
+        } else if (type == "modify") {
+            event.type = OrderEventType::MODIFY;
+            const std::string_view id = field(line, "order_id");
+            ok = ok && !id.empty() && id.size() <= OrderSnapshot::maxIdLength &&
+                 parseSide(field(line, "side"), event.order.side) &&
+                 parseNumber(field(line, "price"), event.order.price) &&
+                 parseNumber(field(line, "quantity"), event.order.quantity);
+            event.order.setId(id);
+            event.quantity = event.order.quantity;
+        } else if (type == "match") {
+            event.type = OrderEventType::MATCH;
+            const std::string_view buy = field(line, "buy_id");
+            const std::string_view sell = field(line, "sell_id");
+            ok = ok && !buy.empty() && !sell.empty() && buy.size() <= OrderSnapshot::maxIdLength &&
+                 sell.size() <= OrderSnapshot::maxIdLength &&
+                 parseNumber(field(line, "price"), event.order.price) &&
+                 parseNumber(field(line, "quantity"), event.quantity);
+            event.order.setId(buy);
+            event.order.side   = OrderType::BUY;
+            event.contra.setId(sell);
+            event.contra.side  = OrderType::SELL;
+            event.contra.price = event.order.price;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            throw std::runtime_error("JsonlReader: line " + std::to_string(lineNumber_) + " is not a TradeLog event");
+        }
+
+        event.sequence  = ++sequence_;
+        event.timestamp = std::chrono::system_clock::time_point{
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds{ms})};
+        return true;
+    }
+    return false;
+}
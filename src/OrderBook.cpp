@@ -1,79 +1,91 @@
 #include "OrderBook.hpp"
-#include "Events/AddOrderEvent.hpp"
-#include "Events/TradeEvent.hpp"
-#include "Events/RemoveOrderEvent.hpp"
+#include "Book/OrderQueue.hpp"
+#include "LimitOrder.hpp"
 
 
+OrderBook::OrderBook(PriceScale priceScale, BookStorage storage, std::size_t orderCapacity)
+    : Base(priceScale, RuntimePrices{storage, {}}, orderCapacity) {}
+
 void OrderBook::addObserver(const std::shared_ptr<IOrderObserver>& observer) {
-    observers.push_back(observer);
+    this->observer<DynamicObservers>().add(observer);
 }
 
 void OrderBook::removeObserver(const std::shared_ptr<IOrderObserver>& observer) {
-    observers.erase(
-        std::ranges::remove(observers, observer).begin(),
-        observers.end()
-    );
+    this->observer<DynamicObservers>().remove(observer);
 }
 
-void OrderBook::notifyObservers(const std::shared_ptr<IEvent>& event) {
-    for (const auto& obs : observers) {
-        obs->onOrderEvent(event);
-    }
+void OrderBook::addDepthObserver(const std::shared_ptr<IDepthObserver>& observer) {
+    this->observer<DynamicObservers>().addDepth(observer);
 }
 
+void OrderBook::removeDepthObserver(const std::shared_ptr<IDepthObserver>& observer) {
+    this->observer<DynamicObservers>().removeDepth(observer);
+}
 
+int OrderBook::addOrder(const std::shared_ptr<IOrder>& order, TimeInForce timeInForce) {
+    getClock().beginMessage();
+    Node& node = acquireNode();
+    assignId(node, order->getId());
+    node.price     = order->getPrice();
+    node.quantity  = order->getQuantity();
+    node.side      = order->getOrderType();
+    node.timestamp = order->getTimestamp();
+    node.origin    = order;
+    return submit(node, timeInForce);
+}
 
-void OrderBook::addOrder(const std::shared_ptr<IOrder>& order) {
-    if (order->getOrderType() == OrderType::BUY) {
-        buyOrders[order->getPrice()].push_back(order);
-    } else {
-        sellOrders[order->getPrice()].push_back(order);
-    }
-    const std::shared_ptr<IEvent> addOrderEvent = std::make_shared<AddOrderEvent>(order);
-    notifyObservers(addOrderEvent);
-
-    matchingEngine(order);
+BatchResult OrderBook::addOrders(std::span<const std::shared_ptr<IOrder>> orders) {
+    return runBatch(orders.size(), [&](std::size_t i) {
+        addOrder(orders[i]);
+        return true;
+    });
 }
 
 void OrderBook::removeOrder(const std::shared_ptr<IOrder>& order) {
-    if (order->getOrderType() == OrderType::BUY) {
-        auto it = buyOrders.find(order->getPrice());
-        if (it != buyOrders.end()) {
-            auto& dq = it->second;
-            dq.erase(std::ranges::remove(dq, order).begin(), dq.end());
-            if (dq.empty()) buyOrders.erase(it);
-        }
-    } else {
-        auto it = sellOrders.find(order->getPrice());
-        if (it != sellOrders.end()) {
-            auto& dq = it->second;
-            dq.erase(std::ranges::remove(dq, order).begin(), dq.end());
-            if (dq.empty()) sellOrders.erase(it);
-        }
-    }
-
-    std::shared_ptr<IEvent> const removeOrderEvent = std::make_shared<RemoveOrderEvent>(order);
-    notifyObservers(removeOrderEvent);
+    cancel(order->getId());
 }
 
+void OrderBook::matchingEngine(const std::shared_ptr<IOrder>& incomingOrder) {
+    Node* node = findNode(incomingOrder->getId());
+    if (node != nullptr && node->origin == incomingOrder) {
+        match(*node);
+    }
+}
 
+BookStorage OrderBook::getStorage() const { return pricePolicy().storage; }
 
-void OrderBook::matchingEngine(const std::shared_ptr<IOrder>& incomingOrder) {
-    if (incomingOrder->getOrderType() == OrderType::BUY) {
-        auto trades = MatchingEngine::match(incomingOrder, buyOrders, sellOrders);
-        for (auto& t : trades) {
-            std::shared_ptr<IEvent> event = std::make_shared<TradeEvent>(t);
-            notifyObservers(event);
+namespace {
+    // The IOrder a snapshot shows for a node: the caller's order if there is
+    // one, otherwise a LimitOrder copy of the node
+    std::shared_ptr<IOrder> orderOf(const SharedOrders::Node& node) {
+        if (node.origin) {
+            return node.origin;
         }
+        return std::make_shared<LimitOrder>(node.getId(), node.side, node.price, node.quantity, node.timestamp);
     }
-    else {
-        auto trades = MatchingEngine::match(incomingOrder, buyOrders, sellOrders);
-        for (auto& t : trades) {
-            std::shared_ptr<IEvent> event = std::make_shared<TradeEvent>(t);
-            notifyObservers(event);
-        }
+
+    // Copies a side into the map-of-deques shape getBuyOrders/getSellOrders return
+    template <typename Map, typename Levels>
+    Map copyLevels(const Levels& levels) {
+        Map copy;
+        levels.forEach([&](Price price, const auto& level) {
+            auto& queue = copy.emplace_hint(copy.end(), price, OrderQueue{})->second;
+            level.forEach([&](const SharedOrders::Node& node) {
+                queue.push_back(orderOf(node));
+            });
+        });
+        return copy;
     }
 }
-std::map<double, std::deque<std::shared_ptr<IOrder>>> OrderBook::getSellOrders() const{return sellOrders;}
-std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>> OrderBook::getBuyOrders() const{return buyOrders;}
 
+std::map<Price, std::deque<std::shared_ptr<IOrder>>> OrderBook::getSellOrders() const {
+    return visitSides([](const auto& s) {
+        return copyLevels<std::map<Price, std::deque<std::shared_ptr<IOrder>>>>(s.sellOrders);
+    });
+}
+
+std::map<Price, std::deque<std::shared_ptr<IOrder>>, std::greater<>> OrderBook::getBuyOrders() const {
+    return visitSides([](const auto& s) {
+        return copyLevels<std::map<Price, std::deque<std::shared_ptr<IOrder>>, std::greater<>>>(s.buyOrders);
+    });
+}
@@ -1,11 +1,24 @@
 #include "OrderFactory.hpp"
-#include "memory"
 
-std::shared_ptr<IOrder> OrderFactory::createLimitOrder(int quantity, int price, OrderType orderType){
+#include <stdexcept>
+#include <string>
+
+std::shared_ptr<IOrder> OrderFactory::createLimitOrder(int quantity, Price price, OrderType orderType){
 	std::chrono::system_clock::time_point creationTime = std::chrono::system_clock::now();
-    std::string orderID = std::to_string(id);
-    id++;
-	std::shared_ptr<IOrder> newOrder = std::make_shared<LimitOrder>(orderID, orderType,price, quantity, creationTime);
+    char orderID[maxOrderIdDigits];
+    const std::size_t length = formatOrderId(nextId(), orderID);
+	std::shared_ptr<IOrder> newOrder = std::make_shared<LimitOrder>(std::string(orderID, length), orderType, price, quantity, creationTime);
     return newOrder;
 }
 
+OrderId OrderFactory::nextId() {
+    const OrderId id = Ids::next();
+    if (id > maxOrderId) {
+        throw std::length_error("OrderFactory: out of order ids");
+    }
+    return id;
+}
+
+void OrderFactory::skipIdsBelow(OrderId next) {
+    Ids::skipBelow(next);
+}
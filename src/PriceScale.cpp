@@ -0,0 +1,35 @@
+#include "Price.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    // Tolerance for decimal input that is on the grid but not exactly
+    // representable as a double (e.g. 100.07 with a 0.01 tick).
+    constexpr double tickEpsilon = 1e-6;
+}
+
+PriceScale::PriceScale(double tickSize) : tickSize(tickSize) {
+    if (!(tickSize > 0.0) || !std::isfinite(tickSize)) {
+        throw std::invalid_argument("PriceScale: tick size must be positive");
+    }
+}
+
+double PriceScale::getTickSize() const { return tickSize; }
+
+Price PriceScale::toTicks(double price) const {
+    const double ticks = price / tickSize;
+    if (!std::isfinite(ticks)) {
+        throw std::invalid_argument("PriceScale: price is not finite");
+    }
+
+    const double rounded = std::round(ticks);
+    if (std::abs(ticks - rounded) > tickEpsilon) {
+        throw std::invalid_argument("PriceScale: price is not a multiple of the tick size");
+    }
+    return static_cast<Price>(rounded);
+}
+
+double PriceScale::toDouble(Price ticks) const {
+    return static_cast<double>(ticks) * tickSize;
+}
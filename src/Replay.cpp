@@ -0,0 +1,123 @@
+#include "Engine/Replay.hpp"
+
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    // Counts the trades of the book it observes
+    struct TradeCounter : IOrderObserver {
+        std::uint64_t trades = 0;
+        void onOrderEvent(const OrderEvent& ev) override {
+            if (ev.type == OrderEventType::MATCH) ++trades;
+        }
+    };
+
+    // Waits until `due`: sleeps while it is far off, then spins
+    void waitUntil(Clock::time_point due) {
+        constexpr auto spinWindow = std::chrono::microseconds{200};
+        for (auto now = Clock::now(); now < due; now = Clock::now()) {
+            if (due - now > spinWindow) {
+                std::this_thread::sleep_for(due - now - spinWindow);
+            }
+        }
+    }
+
+    class Fnv1a {
+    private:
+        std::uint64_t hash = 14695981039346656037ull;
+
+    public:
+        void add(const void* data, std::size_t size) {
+            const auto* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        }
+        template <typename T>
+        void add(const T& value) { add(&value, sizeof(value)); }
+
+        std::uint64_t value() const { return hash; }
+    };
+
+    // Walks the side in place: no copies of the book, no IOrder per order
+    void hashSide(Fnv1a& hash, const OrderBook& book, OrderType side) {
+        const auto sideByte = static_cast<std::uint8_t>(side);
+        book.forEachLevel(side, [&](const LevelView<OrderBook::Node>& level) {
+            const Price price = level.price();
+            char digits[maxOrderIdDigits];
+            for (const auto& order : level) {
+                const std::int32_t quantity = order.quantity;
+                const std::string_view id = order.getId(digits);
+                hash.add(sideByte);
+                hash.add(price);
+                hash.add(id.data(), id.size());
+                hash.add('\0');   // a terminator, so ids cannot run together
+                hash.add(quantity);
+            }
+        });
+    }
+}
+
+ReplayReport replay(OrderBook& book, std::span<const OrderEvent> events, ReplayOptions options) {
+    auto counter = std::make_shared<TradeCounter>();
+    book.addObserver(counter);
+
+    ReplayReport report;
+    const auto start = Clock::now();
+    const auto firstCaptured = events.empty() ? std::chrono::system_clock::time_point{} : events.front().timestamp;
+    // Captured times come through a Simulated clock, put back when done
+    std::optional<ScopedClock<OrderBook>> capturedClock;
+    if (options.capturedTime) {
+        capturedClock.emplace(book, EngineClock{ClockSource::Simulated});
+    }
+
+    for (const auto& ev : events) {
+        if (ev.type == OrderEventType::MATCH) {
+            ++report.capturedTrades;
+            continue;
+        }
+        if (options.speed > 0) {
+            const std::chrono::duration<double> offset = ev.timestamp - firstCaptured;
+            waitUntil(start + std::chrono::duration_cast<Clock::duration>(offset / options.speed));
+        }
+
+        if (options.capturedTime) {
+            book.getClock().set(ev.timestamp);
+        }
+        ++report.messages;
+        if (ev.type == OrderEventType::ADD) {
+            try {
+                book.addOrder(ev.order.getId(), ev.order.side, ev.order.price, ev.order.quantity);
+            } catch (const std::exception&) {
+                ++report.rejected;
+            }
+        } else if (ev.type == OrderEventType::MODIFY) {
+            try {
+                if (!book.modify(ev.order.getId(), ev.order.quantity, ev.order.price)) ++report.rejected;
+            } catch (const std::exception&) {
+                ++report.rejected;
+            }
+        } else if (!book.cancel(ev.order.getId())) {
+            ++report.rejected;
+        }
+    }
+
+    report.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    book.removeObserver(counter);
+    report.trades   = counter->trades;
+    report.checksum = bookChecksum(book);
+    return report;
+}
+
+std::uint64_t bookChecksum(const OrderBook& book) {
+    Fnv1a hash;
+    hashSide(hash, book, OrderType::SELL);
+    hashSide(hash, book, OrderType::BUY);
+    return hash.value();
+}
@@ -1,66 +1,219 @@
 #include "Observer/TradeLog.hpp"
-#include "Interfaces/IEvent.hpp"
-#include "Events/AddOrderEvent.hpp"
-#include "Events/TradeEvent.hpp"
+#include <algorithm>
 #include <chrono>
 #include <iomanip>
 
-TradeLog::TradeLog(const std::string& fileName)
-  : out_(fileName)
+namespace {
+    // Size of the file buffer the async writer fills between flushes
+    constexpr std::size_t asyncBufferSize = std::size_t{1} << 16;
+    // How long the async writer sleeps when it finds nothing to write
+    constexpr std::chrono::microseconds idleSleep{50};
+}
+
+TradeLog::TradeLog(const std::string& fileName, TradeLogOptions options)
+  : options_(options)
 {
+    if (options_.mode == TradeLogMode::Async) {
+        buffer_ = std::make_unique<char[]>(asyncBufferSize);
+        out_.rdbuf()->pubsetbuf(buffer_.get(), asyncBufferSize);
+    }
+    if (options_.retainEvents != TradeLogOptions::allEvents) {
+        events_.reserve(options_.retainEvents);
+    }
+    out_.open(fileName);
     if (!out_) {
         throw std::runtime_error("TradeLog: cannot open " + fileName);
     }
+    if (options_.mode == TradeLogMode::Async) {
+        queue_  = std::make_unique<SpscQueue<OrderEvent>>(options_.queueCapacity);
+        writer_ = std::thread([this] { writerLoop(); });
+    }
+}
+
+TradeLog::~TradeLog() {
+    close();
+}
+
+void TradeLog::onOrderEvent(const OrderEvent& ev) {
+    if (queue_) {
+        enqueue(ev);
+        return;
+    }
+    if (!out_.is_open()) return;
+
+    write(ev);
+    out_.flush();
+}
+
+void TradeLog::onOrderEvents(std::span<const OrderEvent> events) {
+    if (queue_) {
+        for (const auto& ev : events) {
+            enqueue(ev);
+        }
+        return;
+    }
+    if (!out_.is_open()) return;
+
+    for (const auto& ev : events) {
+        write(ev);
+    }
+    out_.flush();
+}
+
+void TradeLog::sync() {
+    if (!queue_) {
+        if (out_.is_open()) out_.flush();
+        return;
+    }
+    if (!writer_.joinable()) return;
+
+    const std::uint64_t target = logged_;
+    if (durable_.load(std::memory_order_acquire) >= target) return;
+    syncUpTo_.store(target, std::memory_order_release);
+    while (durable_.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+void TradeLog::close() {
+    if (writer_.joinable()) {
+        stopping_.store(true, std::memory_order_release);
+        writer_.join();
+    }
+    if (out_.is_open()) out_.close();
+}
+
+// Never drops an event: waits for the writer while the queue is full
+void TradeLog::enqueue(const OrderEvent& ev) {
+    if (!writer_.joinable()) return;
+
+    while (!queue_->tryPush(ev)) {
+        std::this_thread::yield();
+    }
+    ++logged_;
 }
 
-void TradeLog::onOrderEvent(const std::shared_ptr<IEvent> ev) {
-    if (!ev || !out_.is_open()) return;
+// Drains the queue into the file buffer and flushes once flushEvents events
+// are pending, the oldest pending one is flushInterval old, a sync() is
+// waiting, or the log is closing
+void TradeLog::writerLoop() {
+    using Clock = std::chrono::steady_clock;
+
+    std::size_t       pending = 0;
+    Clock::time_point oldestPending{};
+    OrderEvent        ev;
+    while (true) {
+        // Checked before draining: once stopping is seen, everything logged
+        // is already in the queue
+        const bool stopping = stopping_.load(std::memory_order_acquire);
+
+        bool wrote = false;
+        while (queue_->tryPop(ev)) {
+            if (pending == 0) oldestPending = Clock::now();
+            write(ev);
+            ++written_;
+            ++pending;
+            wrote = true;
+            if (pending >= options_.flushEvents) {
+                flush();
+                pending = 0;
+            }
+        }
 
-    // Store in-memory for tests
-    events_.push_back(ev);
+        if (pending > 0 &&
+            (stopping || syncUpTo_.load(std::memory_order_acquire) > written_ - pending ||
+             Clock::now() - oldestPending >= options_.flushInterval)) {
+            flush();
+            pending = 0;
+        }
+        if (stopping) break;
+        if (!wrote) std::this_thread::sleep_for(idleSleep);
+    }
+}
+
+void TradeLog::flush() {
+    out_.flush();
+    durable_.store(written_, std::memory_order_release);
+}
+
+std::vector<OrderEvent> TradeLog::getEvents() const {
+    const std::lock_guard<std::mutex> lock(eventsMutex_);
+    std::vector<OrderEvent> copy;
+    copy.reserve(events_.size());
+    copy.insert(copy.end(), events_.begin() + static_cast<std::ptrdiff_t>(eventsHead_), events_.end());
+    copy.insert(copy.end(), events_.begin(), events_.begin() + static_cast<std::ptrdiff_t>(eventsHead_));
+    return copy;
+}
+
+void TradeLog::retain(const OrderEvent& ev) {
+    if (options_.retainEvents == 0) return;
+
+    const std::lock_guard<std::mutex> lock(eventsMutex_);
+    if (events_.size() < options_.retainEvents) {
+        events_.push_back(ev);
+    } else if (!events_.empty()) {
+        events_[eventsHead_] = ev;
+        eventsHead_ = (eventsHead_ + 1) % events_.size();
+    }
+}
+
+void TradeLog::write(const OrderEvent& ev) {
+    // Keep recent events in memory for inspection
+    retain(ev);
 
     // Serialize to file
+    writeJsonLine(out_, ev);
+}
+
+void writeJsonLine(std::ostream& out, const OrderEvent& ev) {
     using namespace std::chrono;
-    const auto tp = ev->getExecutionTime();
-    const auto ms = duration_cast<milliseconds>(tp.time_since_epoch()).count();
+    const auto ms = duration_cast<milliseconds>(ev.timestamp.time_since_epoch()).count();
 
-    switch (ev->getEventType()) {
+    switch (ev.type) {
       case OrderEventType::ADD: {
-        auto o = ev->getOrder();
-        out_ << "{"
+        const auto& o = ev.order;
+        out << "{"
              << "\"type\":\"add\","
-             << "\"order_id\":\"" << o->getId() << "\","
-             << "\"side\":\""   << (o->getOrderType()==OrderType::BUY?"BUY":"SELL") << "\","
-             << "\"price\":"   << o->getPrice() << ","
-             << "\"quantity\":"<< o->getQuantity() << ","
+             << "\"order_id\":\"" << o.getId() << "\","
+             << "\"side\":\""   << (o.side==OrderType::BUY?"BUY":"SELL") << "\","
+             << "\"price\":"   << o.price << ","
+             << "\"quantity\":"<< o.quantity << ","
              << "\"timestamp\":"<< ms
              << "}\n";
         break;
       }
       case OrderEventType::REMOVE: {
-        auto o = ev->getOrder();
-        out_ << "{"
+        const auto& o = ev.order;
+        out << "{"
              << "\"type\":\"cancel\","
-             << "\"order_id\":\"" << o->getId() << "\","
-             << "\"side\":\""     << (o->getOrderType()==OrderType::BUY?"BUY":"SELL") << "\","
+             << "\"order_id\":\"" << o.getId() << "\","
+             << "\"side\":\""     << (o.side==OrderType::BUY?"BUY":"SELL") << "\","
              << "\"timestamp\":" << ms
              << "}\n";
         break;
       }
+      case OrderEventType::MODIFY: {
+        const auto& o = ev.order;
+        out << "{"
+             << "\"type\":\"modify\","
+             << "\"order_id\":\"" << o.getId() << "\","
+             << "\"side\":\""   << (o.side==OrderType::BUY?"BUY":"SELL") << "\","
+             << "\"price\":"   << o.price << ","
+             << "\"quantity\":"<< o.quantity << ","
+             << "\"timestamp\":"<< ms
+             << "}\n";
+        break;
+      }
       case OrderEventType::MATCH: {
-        if (const auto te = std::dynamic_pointer_cast<TradeEvent>(ev)) {
-          out_ << "{"
-               << "\"type\":\"match\","
-               << "\"buy_id\":\""  << te->getBuyOrder()->getId() << "\","
-               << "\"sell_id\":\"" << te->getSellOrder()->getId() << "\","
-               << "\"price\":"    << te->getPrice() << ","
-               << "\"quantity\":" << te->getQty()   << ","
-               << "\"timestamp\":"<< ms
-               << "}\n";
-        }
+        out << "{"
+             << "\"type\":\"match\","
+             << "\"buy_id\":\""  << ev.buyOrder().getId() << "\","
+             << "\"sell_id\":\"" << ev.sellOrder().getId() << "\","
+             << "\"price\":"    << ev.buyOrder().price << ","
+             << "\"quantity\":" << ev.quantity << ","
+             << "\"timestamp\":"<< ms
+             << "}\n";
         break;
       }
     }
-
-    out_.flush();
 }
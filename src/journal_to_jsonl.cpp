@@ -0,0 +1,42 @@
+// src/journal_to_jsonl.cpp
+// Converts a binary event journal back to the TradeLog JSONL schema.
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "Events/JournalReader.hpp"
+#include "Observer/TradeLog.hpp"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: journal_to_jsonl <journal> [output.jsonl]\n"
+                     "Writes to standard output when no output file is given.\n";
+        return 2;
+    }
+
+    try {
+        JournalReader reader{argv[1]};
+
+        std::ofstream file;
+        if (argc == 3) {
+            file.open(argv[2]);
+            if (!file) {
+                std::cerr << "Cannot open " << argv[2] << "\n";
+                return 1;
+            }
+        }
+        std::ostream& out = argc == 3 ? file : std::cout;
+
+        OrderEvent event;
+        while (reader.next(event)) {
+            writeJsonLine(out, event);
+        }
+        if (reader.truncated()) {
+            std::cerr << "Warning: journal ends with a partial record; it was skipped\n";
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
@@ -4,47 +4,121 @@
 #include <sstream>
 #include <map>
 #include <memory>
+#include <stdexcept>
+#include <algorithm>
+#include <charconv>
+#include <system_error>
+#include <vector>
 
 #include "OrderBook.hpp"
 #include "OrderFactory.hpp"
+#include "Events/JournalCheckpoint.hpp"
+#include "Observer/EventJournal.hpp"
 #include "Observer/TradeLog.hpp"
 
 static void printBook(const OrderBook& book) {
-    std::cout << "\n=== BUY SIDE ===\n";
-    for (const auto& [price, deque] : book.getBuyOrders()) {
-        for (auto& o : deque) {
-            std::cout << "[ID=" << o->getId()
-                      << " Q=" << o->getQuantity()
-                      << " P=" << price << "]  ";
+    const PriceScale& scale = book.getPriceScale();
+    auto printLevel = [&](const LevelView<OrderBook::Node>& level) {
+        for (const auto& order : level) {
+            std::cout << "[ID=" << order.getId()
+                      << " Q=" << order.quantity
+                      << " P=" << scale.toDouble(level.price()) << "]  ";
         }
         std::cout << "\n";
-    }
+    };
+    std::cout << "\n=== BUY SIDE ===\n";
+    book.forEachLevel(OrderType::BUY, printLevel);
     std::cout << "\n=== SELL SIDE ===\n";
-    for (const auto& [price, deque] : book.getSellOrders()) {
-        for (auto& o : deque) {
-            std::cout << "[ID=" << o->getId()
-                      << " Q=" << o->getQuantity()
-                      << " P=" << price << "]  ";
-        }
-        std::cout << "\n";
+    book.forEachLevel(OrderType::SELL, printLevel);
+    std::cout << std::endl;
+}
+
+// Most levels a `depth` command prints per side; larger requests are cut to it
+static constexpr std::size_t maxDepthLevels = 1000;
+
+// The best `levels` price levels of each side, aggregated: asks above bids
+static void printDepth(const OrderBook& book, std::size_t levels) {
+    const PriceScale& scale = book.getPriceScale();
+    std::vector<DepthLevel> depth(levels);
+
+    const std::size_t asks = book.getDepth(OrderType::SELL, depth);
+    std::cout << "\n=== ASKS ===\n";
+    for (std::size_t i = asks; i-- > 0;) {
+        std::cout << scale.toDouble(depth[i].price) << "  " << depth[i].quantity
+                  << " (" << depth[i].orderCount << " orders)\n";
+    }
+    const std::size_t bids = book.getDepth(OrderType::BUY, depth);
+    std::cout << "=== BIDS ===\n";
+    for (std::size_t i = 0; i < bids; ++i) {
+        std::cout << scale.toDouble(depth[i].price) << "  " << depth[i].quantity
+                  << " (" << depth[i].orderCount << " orders)\n";
     }
     std::cout << std::endl;
 }
 
-int main() {
-    OrderBook book;
-    auto logger = std::make_shared<TradeLog>("trades.jsonl");
+// One past the largest numeric order id in the book or the journal (as
+// recovery left it), so new orders never reuse an id from before a restart
+static OrderId nextFreeId(const OrderBook& book, const JournalCheckpoint& journal) {
+    OrderId next = journal.nextOrderId;
+    auto seeLevel = [&](const LevelView<OrderBook::Node>& level) {
+        for (const auto& order : level) {
+            if ((order.key & textKeyBit) == 0 && order.key >= next) next = order.key + 1;
+        }
+    };
+    book.forEachLevel(OrderType::BUY, seeLevel);
+    book.forEachLevel(OrderType::SELL, seeLevel);
+    return next;
+}
 
-    book.addObserver(logger);
+int main(int argc, char* argv[]) {
+    // Prices are entered as decimals and stored as whole ticks of this size
+    double tickSize = 0.01;
+    if (argc > 1) {
+        tickSize = std::stod(argv[1]);
+    }
 
-    // keep track of every order we create so we can remove by ID
-    std::map<std::string, std::shared_ptr<IOrder>> allOrders;
+    const std::string snapshotFile = "trades.snapshot";
+    const std::string journalFile  = "trades.journal";
+
+    // Pick up the book the previous run left: its last snapshot plus the
+    // journal recorded since
+    OrderBook book{PriceScale{tickSize}};
+    JournalCheckpoint recovered;
+    try {
+        recovered = book.recover(snapshotFile, journalFile);
+    } catch (const std::exception& e) {
+        std::cerr << "Cannot recover the previous book: " << e.what() << "\n";
+        return 1;
+    }
+    if (book.getOrderCount() > 0) {
+        std::cout << "Recovered " << book.getOrderCount() << " resting orders.\n";
+    }
+    OrderFactory::skipIdsBelow(nextFreeId(book, recovered));
+
+    std::shared_ptr<TradeLog> logger;
+    std::shared_ptr<EventJournal> journal;
+    try {
+        logger = std::make_shared<TradeLog>("trades.jsonl");
+        // The same events in the compact binary format (see journal_to_jsonl),
+        // continued across restarts from where recovery stopped reading
+        journal = std::make_shared<EventJournal>(journalFile, recovered);
+    } catch (const std::exception& e) {
+        std::cerr << "Cannot open the logs: " << e.what() << "\n";
+        return 1;
+    }
+
+    book.addObserver(logger);
+    book.addObserver(journal);
 
     std::cout << "Welcome to OrderBook CLI!\n";
     std::cout << "Commands:\n"
                  "  add BUY|SELL <qty> <price>\n"
                  "  remove <order_id>\n"
+                 "  modify <order_id> <qty> <price>\n"
                  "  print\n"
+                 "  depth [levels]\n"
+                 "  save\n"
+                 "  stats\n"
                  "  exit\n\n";
 
     std::string line;
@@ -60,6 +134,32 @@ int main() {
         else if (cmd == "print") {
             printBook(book);
         }
+        else if (cmd == "depth") {
+            std::size_t levels = 5;
+            std::string count;
+            if (iss >> count) {
+                const auto [end, ec] = std::from_chars(count.data(), count.data() + count.size(), levels);
+                if (ec != std::errc{} || end != count.data() + count.size()) {
+                    std::cout << "Usage: depth [levels]\n";
+                    continue;
+                }
+            }
+            printDepth(book, std::min(levels, maxDepthLevels));
+        }
+        else if (cmd == "stats") {
+            dumpStats(std::cout, book.getStats());
+        }
+        else if (cmd == "save") {
+            // A failed save leaves the previous snapshot in place; the
+            // session goes on
+            try {
+                book.saveSnapshot(snapshotFile, journal->checkpoint());
+            } catch (const std::exception& e) {
+                std::cerr << "Cannot save the book: " << e.what() << "\n";
+                continue;
+            }
+            std::cout << "Saved " << book.getOrderCount() << " orders to " << snapshotFile << "\n";
+        }
         else if (cmd == "add") {
             std::string side;
             int qty;
@@ -71,9 +171,23 @@ int main() {
             OrderType t = (side == "BUY")
                             ? OrderType::BUY
                             : OrderType::SELL;
-            auto order = OrderFactory::createLimitOrder(qty, price, t);
-            allOrders[order->getId()] = order;
-            book.addOrder(order);
+            Price ticks;
+            try {
+                ticks = book.getPriceScale().toTicks(price);
+            } catch (const std::invalid_argument&) {
+                std::cout << "Invalid price " << price << ": tick size is "
+                          << book.getPriceScale().getTickSize() << "\n";
+                continue;
+            }
+            auto order = OrderFactory::createLimitOrder(qty, ticks, t);
+            try {
+                book.addOrder(order);
+            } catch (const std::exception& e) {
+                std::cout << "Cannot add order: " << e.what() << "\n";
+                continue;
+            }
+            // Interactive rates: make every command durable at once
+            journal->sync();
             std::cout << "Added " << side
                       << " order ID=" << order->getId()
                       << " Q=" << qty
@@ -85,13 +199,34 @@ int main() {
                 std::cout << "Usage: remove <order_id>\n";
                 continue;
             }
-            auto it = allOrders.find(id);
-            if (it == allOrders.end()) {
+            const bool removed = book.cancel(id);
+            journal->sync();
+            if (removed) {
+                std::cout << "Removed order " << id << "\n";
+            } else {
                 std::cout << "No such order: " << id << "\n";
+            }
+        }
+        else if (cmd == "modify") {
+            std::string id;
+            int qty;
+            double price;
+            if (!(iss >> id >> qty >> price)) {
+                std::cout << "Usage: modify <order_id> <qty> <price>\n";
+                continue;
+            }
+            bool modified;
+            try {
+                modified = book.modify(id, qty, book.getPriceScale().toTicks(price));
+            } catch (const std::exception& e) {
+                std::cout << "Cannot modify order " << id << ": " << e.what() << "\n";
+                continue;
+            }
+            journal->sync();
+            if (modified) {
+                std::cout << "Modified order " << id << " Q=" << qty << " P=" << price << "\n";
             } else {
-                book.removeOrder(it->second);
-                std::cout << "Removed order " << id << "\n";
-                allOrders.erase(it);
+                std::cout << "No such order: " << id << "\n";
             }
         }
         else {
@@ -99,6 +234,14 @@ int main() {
         }
     }
 
+    // The journal holds everything regardless; the snapshot only shortens
+    // the next start
+    try {
+        book.saveSnapshot(snapshotFile, journal->checkpoint());
+    } catch (const std::exception& e) {
+        std::cerr << "Cannot save the book: " << e.what() << "\n";
+        return 1;
+    }
     std::cout << "Goodbye.\n";
     return 0;
 }
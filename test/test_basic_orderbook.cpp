@@ -0,0 +1,234 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Compile-time observers
+// ——————————————————————————————————————————
+
+// Records each block of events it is handed, as "kind:id" strings (with
+// the quantity for modifies and trades)
+struct BlockRecorder {
+    std::vector<std::vector<std::string>> blocks;
+
+    void onEvents(std::span<const OrderEvent> events) {
+        auto& block = blocks.emplace_back();
+        for (const auto& ev : events) {
+            switch (ev.type) {
+                case OrderEventType::ADD:    block.push_back("add:" + std::string(ev.order.getId())); break;
+                case OrderEventType::REMOVE: block.push_back("remove:" + std::string(ev.order.getId())); break;
+                case OrderEventType::MODIFY:
+                    block.push_back("modify:" + std::string(ev.order.getId()) + "x" + std::to_string(ev.order.quantity));
+                    break;
+                case OrderEventType::MATCH:
+                    block.push_back("trade:" + std::string(ev.buyOrder().getId()) + "/" +
+                                    std::string(ev.sellOrder().getId()) + "x" + std::to_string(ev.quantity));
+                    break;
+            }
+        }
+    }
+};
+
+// Takes events one at a time and only cares about trades
+struct TradeCounter {
+    int trades = 0;
+    int volume = 0;
+    std::uint64_t lastSequence = 0;
+
+    void onEvent(const OrderEvent& ev) {
+        lastSequence = ev.sequence;
+        if (ev.type == OrderEventType::MATCH) {
+            ++trades;
+            volume += ev.quantity;
+        }
+    }
+};
+
+// Can be switched off; while it is, the book builds no events for it
+struct SwitchableObserver {
+    bool enabled = false;
+    std::vector<std::uint64_t> sequences;
+
+    bool wantsEvents() const { return enabled; }
+    void onEvent(const OrderEvent& ev) { sequences.push_back(ev.sequence); }
+};
+
+using MapBook    = BasicOrderBook<PooledOrders, MapPrices, BlockRecorder, TradeCounter>;
+using LadderBook = BasicOrderBook<PooledOrders, LadderPrices, BlockRecorder, TradeCounter>;
+
+TEMPLATE_TEST_CASE("BasicOrderBook hands each operation's events to its static observers", "[BasicOrderBook]",
+                   MapBook, LadderBook) {
+    TestType book;
+
+    book.addOrder("s1", OrderType::SELL, 100, 3);
+    book.addOrder("s2", OrderType::SELL, 101, 3);
+    book.addOrder("b1", OrderType::BUY, 101, 4);
+    REQUIRE(book.cancel("s2"));
+    REQUIRE_FALSE(book.cancel("s2"));
+
+    // A shrink in place, a reprice that trades, and one that changes nothing
+    book.addOrder("b2", OrderType::BUY, 99, 4);
+    REQUIRE(book.modify("b2", 2, 99));
+    book.addOrder("s3", OrderType::SELL, 102, 3);
+    REQUIRE(book.modify("s3", 3, 99));
+    REQUIRE(book.modify("s3", 1, 99));
+
+    const std::vector<std::vector<std::string>> expected{
+        {"add:s1"},
+        {"add:s2"},
+        {"add:b1", "trade:b1/s1x3", "trade:b1/s2x1"},
+        {"remove:s2"},
+        {"add:b2"},
+        {"modify:b2x2"},
+        {"add:s3"},
+        {"modify:s3x3", "trade:b2/s3x2"},
+    };
+    REQUIRE(book.template observer<BlockRecorder>().blocks == expected);
+    REQUIRE(book.template observer<TradeCounter>().trades == 3);
+    REQUIRE(book.template observer<TradeCounter>().volume == 6);
+    REQUIRE(book.template observer<TradeCounter>().lastSequence == 11);
+    REQUIRE(book.getOrderCount() == 1);
+}
+
+// Keeps every event as raised
+struct EventRecorder {
+    std::vector<OrderEvent> events;
+
+    void onEvents(std::span<const OrderEvent> batch) { events.insert(events.end(), batch.begin(), batch.end()); }
+};
+
+TEST_CASE("Trades of a multi-level sweep show each order as it stood after that fill", "[BasicOrderBook]") {
+    BasicOrderBook<PooledOrders, MapPrices, EventRecorder> book;
+    auto& events = book.observer<EventRecorder>().events;
+    book.addOrder("s1", OrderType::SELL, 100, 10);
+    book.addOrder("s2", OrderType::SELL, 101, 10);
+    book.addOrder("s3", OrderType::SELL, 102, 10);
+    events.clear();
+
+    book.addOrder("b", OrderType::BUY, 102, 30);
+    REQUIRE(events.size() == 4);
+    REQUIRE(events[0].order.quantity == 30);
+    for (int i = 1; i <= 3; ++i) {
+        const OrderEvent& trade = events[i];
+        REQUIRE(trade.type == OrderEventType::MATCH);
+        REQUIRE(trade.quantity == 10);
+        REQUIRE(trade.buyOrder().quantity == 30 - 10 * i);
+        REQUIRE(trade.sellOrder().getId() == "s" + std::to_string(i));
+        REQUIRE(trade.sellOrder().quantity == 0);
+    }
+
+    // The same for an incoming sell, which is the contra side of its trades
+    book.addOrder("b1", OrderType::BUY, 99, 5);
+    book.addOrder("b2", OrderType::BUY, 98, 5);
+    events.clear();
+    book.addOrder("x", OrderType::SELL, 98, 8);
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[1].sellOrder().quantity == 3);
+    REQUIRE(events[1].buyOrder().quantity == 0);
+    REQUIRE(events[2].sellOrder().quantity == 0);
+    REQUIRE(events[2].buyOrder().quantity == 2);
+}
+
+TEST_CASE("BasicOrderBook builds events only while an observer wants them", "[BasicOrderBook]") {
+    BasicOrderBook<PooledOrders, MapPrices, SwitchableObserver> book;
+
+    book.addOrder("s1", OrderType::SELL, 100, 1);
+    REQUIRE(book.observer<SwitchableObserver>().sequences.empty());
+
+    // Sequence numbers keep counting while nobody listens
+    book.observer<SwitchableObserver>().enabled = true;
+    book.addOrder("b1", OrderType::BUY, 100, 1);
+    REQUIRE(book.observer<SwitchableObserver>().sequences == std::vector<std::uint64_t>{2, 3});
+}
+
+TEST_CASE("BasicOrderBook without observers matches and rejects like OrderBook", "[BasicOrderBook]") {
+    BasicOrderBook<PooledOrders, LadderPrices> book{PriceScale{0.5}, LadderPrices{64, 256}};
+    REQUIRE(book.getPriceScale().getTickSize() == 0.5);
+
+    book.addOrder("b1", OrderType::BUY, 200, 5);
+    REQUIRE_THROWS_AS(book.addOrder("b1", OrderType::BUY, 199, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(book.addOrder("b2", OrderType::BUY, 199, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(book.addOrder("far", OrderType::BUY, 200 - 1000, 1), std::length_error);
+    REQUIRE(book.getOrderCount() == 1);
+
+    book.addOrder("s1", OrderType::SELL, 199, 2);
+    REQUIRE(book.getOrderCount() == 1);
+    book.addOrder("s2", OrderType::SELL, 200, 3);
+    REQUIRE(book.getOrderCount() == 0);
+}
+
+TEMPLATE_TEST_CASE("Incoming orders trade before resting, per their time in force", "[BasicOrderBook]",
+                   MapBook, LadderBook) {
+    TestType book;
+    auto& blocks = book.template observer<BlockRecorder>().blocks;
+    book.addOrder("s1", OrderType::SELL, 100, 3);
+    book.addOrder("s2", OrderType::SELL, 101, 3);
+    blocks.clear();
+
+    // Fill-or-kill that cannot fill in full leaves everything as it was
+    REQUIRE(book.addOrder("fok1", OrderType::BUY, 101, 7, TimeInForce::FillOrKill) == 0);
+    REQUIRE(blocks.empty());
+    REQUIRE(book.getOrderCount() == 2);
+
+    // Immediate-or-cancel takes what is there and cancels the rest
+    REQUIRE(book.addOrder("ioc1", OrderType::BUY, 100, 5, TimeInForce::ImmediateOrCancel) == 3);
+    REQUIRE(blocks.back() == std::vector<std::string>{"add:ioc1", "trade:ioc1/s1x3", "remove:ioc1"});
+    REQUIRE(book.getOrderCount() == 1);
+    REQUIRE_FALSE(book.getTopOfBook().hasBid());
+
+    // Fill-or-kill that can fill does
+    REQUIRE(book.addOrder("fok2", OrderType::BUY, 101, 3, TimeInForce::FillOrKill) == 3);
+    REQUIRE(blocks.back() == std::vector<std::string>{"add:fok2", "trade:fok2/s2x3"});
+    REQUIRE(book.getOrderCount() == 0);
+
+    // Good-till-cancel rests only the remainder
+    book.addOrder("s3", OrderType::SELL, 102, 2);
+    REQUIRE(book.addOrder("gtc", OrderType::BUY, 102, 5) == 2);
+    REQUIRE(book.getBestBid() == DepthLevel{102, 3, 1});
+    REQUIRE_FALSE(book.getTopOfBook().hasAsk());
+}
+
+TEST_CASE("A numeric id and its decimal text name the same order", "[BasicOrderBook]") {
+    BasicOrderBook<PooledOrders, MapPrices> book;
+    book.addOrder(OrderId{42}, OrderType::BUY, 100, 5);
+    book.addOrder("007", OrderType::BUY, 99, 1);
+    book.addOrder(maxOrderId, OrderType::SELL, 110, 2);
+
+    REQUIRE(book.find("42") == book.find(OrderId{42}));
+    REQUIRE(book.find(OrderId{42})->getId() == "42");
+    REQUIRE(book.find("42")->textId.empty());   // kept as its key; formatted only on request
+    REQUIRE(book.find(maxOrderId)->getId() == "999999999999999999");
+    REQUIRE_THROWS_AS(book.addOrder("42", OrderType::SELL, 120, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(book.addOrder(maxOrderId + 1, OrderType::SELL, 120, 1), std::invalid_argument);
+
+    // "007" is text, not order 7
+    REQUIRE(book.find(OrderId{7}) == nullptr);
+    REQUIRE(book.find("007")->quantity == 1);
+    REQUIRE(book.find("007")->getId() == "007");
+
+    REQUIRE(book.modify(OrderId{42}, 3, 100));
+    REQUIRE(book.find("42")->quantity == 3);
+    REQUIRE(book.cancel(maxOrderId));
+    REQUIRE_FALSE(book.cancel(std::to_string(maxOrderId)));
+    REQUIRE(book.cancel("42"));
+    REQUIRE_FALSE(book.cancel(OrderId{42}));
+    REQUIRE(book.getOrderCount() == 1);
+}
+
+TEST_CASE("Orders that will not rest need no room on a ladder", "[BasicOrderBook]") {
+    BasicOrderBook<PooledOrders, LadderPrices> book{PriceScale{}, LadderPrices{64, 256}};
+    book.addOrder("s1", OrderType::SELL, 200, 5);
+    book.addOrder("b1", OrderType::BUY, 190, 1);
+
+    REQUIRE_THROWS_AS(book.addOrder("far", OrderType::BUY, 200 - 1000, 1), std::length_error);
+    REQUIRE(book.addOrder("sweep", OrderType::BUY, 200 + 1000, 2, TimeInForce::ImmediateOrCancel) == 2);
+    REQUIRE(book.addOrder("kill", OrderType::BUY, 200 + 1000, 9, TimeInForce::FillOrKill) == 0);
+    REQUIRE(book.getBestAsk() == DepthLevel{200, 3, 1});
+}
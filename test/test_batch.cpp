@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "Engine/EngineRunner.hpp"
+#include "LimitOrder.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Batched submission
+// ——————————————————————————————————————————
+
+// Keeps every block of events it is handed, as "kind:id[/contra]xqty" strings
+struct EventBlocks {
+    std::vector<std::vector<std::string>> blocks;
+
+    void onEvents(std::span<const OrderEvent> events) {
+        auto& block = blocks.emplace_back();
+        for (const auto& ev : events) {
+            std::string text = ev.type == OrderEventType::ADD      ? "add:"
+                             : ev.type == OrderEventType::REMOVE   ? "remove:"
+                                                                   : "trade:";
+            text += std::string(ev.order.getId());
+            if (ev.type == OrderEventType::MATCH) text += "/" + std::string(ev.contra.getId());
+            block.push_back(text + "x" + std::to_string(ev.quantity));
+        }
+    }
+};
+
+using MapBatchBook    = BasicOrderBook<PooledOrders, MapPrices, EventBlocks>;
+using LadderBatchBook = BasicOrderBook<PooledOrders, LadderPrices, EventBlocks>;
+
+static std::vector<OrderCommand> burst() {
+    return {
+        OrderCommand::add("s1", OrderType::SELL, 101, 5),
+        OrderCommand::add("s2", OrderType::SELL, 101, 5),
+        OrderCommand::add("b1", OrderType::BUY, 99, 4),
+        OrderCommand::add("s1", OrderType::SELL, 102, 1),    // duplicate id
+        OrderCommand::add("b2", OrderType::BUY, 101, 7),     // takes s1, part of s2
+        OrderCommand::cancel("nope"),
+        OrderCommand::add("bad", OrderType::BUY, 100, 0),    // non-positive quantity
+        OrderCommand::cancel("b1"),
+        OrderCommand::add("s3", OrderType::SELL, 100, 2),
+    };
+}
+
+TEMPLATE_TEST_CASE("A batch applies like its commands one by one and publishes once", "[Batch]",
+                   MapBatchBook, LadderBatchBook) {
+    const std::vector<OrderCommand> commands = burst();
+
+    TestType single;
+    std::size_t singleRejected = 0;
+    for (const auto& command : commands) {
+        try {
+            if (!applyCommand(single, command)) ++singleRejected;
+        } catch (const std::invalid_argument&) {
+            ++singleRejected;
+        }
+    }
+
+    TestType batched;
+    const BatchResult result = batched.applyBatch(commands);
+    REQUIRE(result.applied == commands.size() - 3);
+    REQUIRE(result.rejected == 3);
+    REQUIRE(singleRejected == 3);
+
+    // The same events in the same order, in one block instead of one per command
+    std::vector<std::string> flattened;
+    for (const auto& block : single.template observer<EventBlocks>().blocks) {
+        flattened.insert(flattened.end(), block.begin(), block.end());
+    }
+    const auto& blocks = batched.template observer<EventBlocks>().blocks;
+    REQUIRE(blocks.size() == 1);
+    REQUIRE(blocks[0] == flattened);
+
+    REQUIRE(batched.getOrderCount() == single.getOrderCount());
+    REQUIRE(batched.getTopOfBook() == single.getTopOfBook());
+    REQUIRE(batched.getBestAsk() == DepthLevel{100, 2, 1});
+    REQUIRE_FALSE(batched.getTopOfBook().hasBid());
+
+    // An empty batch publishes nothing
+    REQUIRE(batched.applyBatch({}).applied == 0);
+    REQUIRE(blocks.size() == 1);
+}
+
+// Counts the dispatches it receives
+struct BlockCounter : IOrderObserver {
+    int blocks = 0;
+    int events = 0;
+
+    void onOrderEvent(const OrderEvent&) override { ++events; }
+    void onOrderEvents(std::span<const OrderEvent> batch) override {
+        ++blocks;
+        events += static_cast<int>(batch.size());
+    }
+};
+
+TEST_CASE("OrderBook::addOrders dispatches a burst of IOrders as one block", "[Batch][OrderBook]") {
+    OrderBook book;
+    auto counter = std::make_shared<BlockCounter>();
+    book.addObserver(counter);
+
+    const auto now = std::chrono::system_clock::now();
+    const std::vector<std::shared_ptr<IOrder>> orders{
+        std::make_shared<LimitOrder>("a", OrderType::SELL, 100, 3, now),
+        std::make_shared<LimitOrder>("b", OrderType::BUY, 100, 2, now),
+        std::make_shared<LimitOrder>("a", OrderType::BUY, 90, 1, now),   // duplicate id
+    };
+    const BatchResult result = book.addOrders(orders);
+    REQUIRE(result.applied == 2);
+    REQUIRE(result.rejected == 1);
+    REQUIRE(counter->blocks == 1);
+    REQUIRE(counter->events == 3);   // two adds, one trade
+    REQUIRE(orders[0]->getQuantity() == 1);
+    REQUIRE(book.getOrderCount() == 1);
+}
+
+TEST_CASE("EngineRunner applying batches ends with the same book and counts", "[Batch][EngineRunner]") {
+    auto runWith = [](std::size_t batchSize) {
+        auto book = std::make_unique<MapBatchBook>();
+        {
+            EngineRunner<MapBatchBook> runner{*book, RunnerOptions{1024, Backpressure::Spin, -1, batchSize}};
+            for (int round = 0; round < 50; ++round) {
+                for (const auto& command : burst()) {
+                    OrderCommand renamed = command;
+                    renamed.order.setId(std::string(command.order.getId()) + "_" + std::to_string(round));
+                    runner.submit(renamed);
+                }
+            }
+            runner.stop();
+            REQUIRE(runner.getProcessedCount() == 50 * burst().size());
+            REQUIRE(runner.getRejectedCount() == 50 * 3);
+        }
+        return book;
+    };
+
+    const auto single  = runWith(1);
+    const auto batched = runWith(32);
+    REQUIRE(batched->getOrderCount() == single->getOrderCount());
+    REQUIRE(batched->getTopOfBook() == single->getTopOfBook());
+}
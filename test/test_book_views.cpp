@@ -0,0 +1,94 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <iterator>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Level and order views
+// ——————————————————————————————————————————
+
+using MapViewBook    = BasicOrderBook<PooledOrders, MapPrices>;
+using LadderViewBook = BasicOrderBook<PooledOrders, LadderPrices>;
+
+static_assert(std::forward_iterator<PriceLevel<PooledOrders::Node>::const_iterator>);
+
+TEMPLATE_TEST_CASE("forEachLevel walks levels best first and stops by depth, price or visitor", "[Views]",
+                   MapViewBook, LadderViewBook) {
+    TestType book;
+    book.addOrder("s1", OrderType::SELL, 101, 1);
+    book.addOrder("s2", OrderType::SELL, 101, 2);
+    book.addOrder("s3", OrderType::SELL, 103, 3);
+    book.addOrder("s4", OrderType::SELL, 107, 4);
+    book.addOrder("b1", OrderType::BUY, 99, 5);
+    book.addOrder("b2", OrderType::BUY, 95, 6);
+
+    using View = LevelView<typename TestType::Node>;
+    auto pricesOf = [&](OrderType side, LevelRange range) {
+        std::vector<Price> prices;
+        book.forEachLevel(side, [&](const View& level) { prices.push_back(level.price()); }, range);
+        return prices;
+    };
+
+    REQUIRE(pricesOf(OrderType::SELL, {}) == std::vector<Price>{101, 103, 107});
+    REQUIRE(pricesOf(OrderType::BUY, {}) == std::vector<Price>{99, 95});
+    REQUIRE(pricesOf(OrderType::SELL, {2, std::nullopt}) == std::vector<Price>{101, 103});
+    REQUIRE(pricesOf(OrderType::SELL, {0, std::nullopt}).empty());
+    REQUIRE(pricesOf(OrderType::SELL, {LevelRange{}.depth, 106}) == std::vector<Price>{101, 103});
+    REQUIRE(pricesOf(OrderType::BUY, {LevelRange{}.depth, 99}) == std::vector<Price>{99});
+    REQUIRE(pricesOf(OrderType::BUY, {LevelRange{}.depth, 100}).empty());
+
+    // Stops once the visitor has seen 4 units of quantity
+    std::int64_t seen = 0;
+    int levels = 0;
+    book.forEachLevel(OrderType::SELL, [&](const View& level) {
+        ++levels;
+        seen += level.quantity();
+        return seen < 4;
+    });
+    REQUIRE(levels == 2);
+    REQUIRE(seen == 6);
+}
+
+TEMPLATE_TEST_CASE("A level view iterates its orders in time priority", "[Views]", MapViewBook, LadderViewBook) {
+    TestType book;
+    book.addOrder("a", OrderType::BUY, 50, 1);
+    book.addOrder("b", OrderType::BUY, 50, 2);
+    book.addOrder("c", OrderType::BUY, 50, 3);
+    REQUIRE(book.cancel("b"));
+
+    std::vector<std::string> ids;
+    book.forEachLevel(OrderType::BUY, [&](const LevelView<typename TestType::Node>& level) {
+        REQUIRE(level.orderCount() == 2);
+        REQUIRE(level.quantity() == 4);
+        REQUIRE(level.front().getId() == "a");
+        for (const auto& order : level) ids.push_back(order.getId());
+    });
+    REQUIRE(ids == std::vector<std::string>{"a", "c"});
+}
+
+TEST_CASE("OrderBook views show the same orders as getBuyOrders/getSellOrders", "[Views][OrderBook]") {
+    for (auto storage : {BookStorage::Map, BookStorage::Ladder}) {
+        OrderBook book{PriceScale{}, storage};
+        for (int i = 0; i < 30; ++i) {
+            book.addOrder("b" + std::to_string(i), OrderType::BUY, 90 + i % 7, 1 + i % 4);
+            book.addOrder("s" + std::to_string(i), OrderType::SELL, 100 + i % 5, 1 + i % 3);
+        }
+
+        std::vector<std::string> viewed;
+        std::vector<std::string> copied;
+        book.forEachLevel(OrderType::BUY, [&](const LevelView<OrderBook::Node>& level) {
+            for (const auto& order : level) viewed.push_back(order.getId() + "@" + std::to_string(level.price()));
+        });
+        for (const auto& [price, orders] : book.getBuyOrders()) {
+            for (const auto& order : orders) copied.push_back(order->getId() + "@" + std::to_string(price));
+        }
+        REQUIRE(viewed == copied);
+        REQUIRE(viewed.size() == 30);
+    }
+}
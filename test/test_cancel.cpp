@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+#include "LimitOrder.hpp"
+#include "Events/OrderEvent.hpp"
+
+struct CancelRecorder : IOrderObserver {
+    std::vector<OrderEvent> receivedEvents;
+    void onOrderEvent(const OrderEvent& ev) override {
+        receivedEvents.push_back(ev);
+    }
+};
+
+// Ids of the orders resting at one sell price, front to back
+static std::vector<std::string> idsAt(const OrderBook& book, Price price) {
+    std::vector<std::string> ids;
+    const auto asks = book.getSellOrders();
+    for (const auto& o : asks.at(price)) {
+        ids.push_back(o->getId());
+    }
+    return ids;
+}
+
+TEST_CASE("Cancel by id unlinks from the front, middle and back of a level", "[OrderBook][cancel]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
+
+    auto a = OrderFactory::createLimitOrder(1, 100, OrderType::SELL);
+    auto b = OrderFactory::createLimitOrder(1, 100, OrderType::SELL);
+    auto c = OrderFactory::createLimitOrder(1, 100, OrderType::SELL);
+    auto d = OrderFactory::createLimitOrder(1, 100, OrderType::SELL);
+    auto e = OrderFactory::createLimitOrder(1, 100, OrderType::SELL);
+    for (const auto& o : {a, b, c, d, e}) book.addOrder(o);
+
+    REQUIRE(book.cancel(c->getId()));
+    REQUIRE(idsAt(book, 100) == std::vector<std::string>{a->getId(), b->getId(), d->getId(), e->getId()});
+
+    REQUIRE(book.cancel(a->getId()));
+    REQUIRE(book.cancel(e->getId()));
+    REQUIRE(idsAt(book, 100) == std::vector<std::string>{b->getId(), d->getId()});
+
+    REQUIRE(book.cancel(b->getId()));
+    REQUIRE(book.cancel(d->getId()));
+    REQUIRE(book.getSellOrders().empty());
+}
+
+TEST_CASE("Cancel keeps time priority for the orders that remain", "[OrderBook][cancel][match]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
+    auto obs = std::make_shared<CancelRecorder>();
+    book.addObserver(obs);
+
+    auto first  = OrderFactory::createLimitOrder(2, 100, OrderType::SELL);
+    auto middle = OrderFactory::createLimitOrder(2, 100, OrderType::SELL);
+    auto last   = OrderFactory::createLimitOrder(2, 100, OrderType::SELL);
+    book.addOrder(first);
+    book.addOrder(middle);
+    book.addOrder(last);
+    REQUIRE(book.cancel(middle->getId()));
+    obs->receivedEvents.clear();
+
+    book.addOrder(OrderFactory::createLimitOrder(3, 100, OrderType::BUY));
+
+    std::vector<OrderEvent> trades;
+    for (const auto& ev : obs->receivedEvents) {
+        if (ev.type == OrderEventType::MATCH) trades.push_back(ev);
+    }
+    REQUIRE(trades.size() == 2);
+    REQUIRE(trades[0].sellOrder().getId() == first->getId());
+    REQUIRE(trades[1].sellOrder().getId() == last->getId());
+    REQUIRE(last->getQuantity() == 1);
+}
+
+TEST_CASE("Cancel emits one REMOVE event and ignores unknown ids", "[OrderBook][cancel]") {
+    OrderBook book;
+    auto obs = std::make_shared<CancelRecorder>();
+    book.addObserver(obs);
+
+    auto o = OrderFactory::createLimitOrder(4, 55, OrderType::BUY);
+    book.addOrder(o);
+    obs->receivedEvents.clear();
+
+    REQUIRE_FALSE(book.cancel("no-such-order"));
+    REQUIRE(obs->receivedEvents.empty());
+
+    REQUIRE(book.cancel(o->getId()));
+    REQUIRE(obs->receivedEvents.size() == 1);
+    const auto& ev = obs->receivedEvents[0];
+    REQUIRE(ev.type == OrderEventType::REMOVE);
+    REQUIRE(ev.order.getId() == o->getId());
+
+    // A second cancel of the same id finds nothing
+    REQUIRE_FALSE(book.cancel(o->getId()));
+    REQUIRE(obs->receivedEvents.size() == 1);
+}
+
+TEST_CASE("Filled orders can no longer be cancelled", "[OrderBook][cancel][match]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
+
+    auto sell = OrderFactory::createLimitOrder(5, 100, OrderType::SELL);
+    auto buy  = OrderFactory::createLimitOrder(5, 100, OrderType::BUY);
+    book.addOrder(sell);
+    book.addOrder(buy);
+
+    REQUIRE_FALSE(book.cancel(sell->getId()));
+    REQUIRE_FALSE(book.cancel(buy->getId()));
+    REQUIRE(book.getBuyOrders().empty());
+    REQUIRE(book.getSellOrders().empty());
+}
+
+TEST_CASE("Adding an order whose id is already resting throws", "[OrderBook][cancel]") {
+    OrderBook book;
+    auto now = std::chrono::system_clock::now();
+    book.addOrder(std::make_shared<LimitOrder>("dup", OrderType::BUY, 10, 1, now));
+
+    REQUIRE_THROWS_AS(
+        book.addOrder(std::make_shared<LimitOrder>("dup", OrderType::SELL, 20, 1, now)),
+        std::invalid_argument);
+    REQUIRE(book.getSellOrders().empty());
+    REQUIRE(book.getBuyOrders().size() == 1);
+}
@@ -0,0 +1,168 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Level aggregates, depth queries and L2 deltas
+// ——————————————————————————————————————————
+
+// Keeps each operation's deltas as one block
+struct DeltaRecorder {
+    std::vector<std::vector<LevelUpdate>> blocks;
+
+    void onLevelUpdates(std::span<const LevelUpdate> updates) { blocks.emplace_back(updates.begin(), updates.end()); }
+};
+
+using MapDepthBook    = BasicOrderBook<PooledOrders, MapPrices, DeltaRecorder>;
+using LadderDepthBook = BasicOrderBook<PooledOrders, LadderPrices, DeltaRecorder>;
+
+static bool sameLevel(const DepthLevel& level, Price price, std::int64_t quantity, std::uint32_t orderCount) {
+    return level.price == price && level.quantity == quantity && level.orderCount == orderCount;
+}
+
+TEMPLATE_TEST_CASE("Levels keep their total quantity and order count through fills and cancels", "[Depth]",
+                   MapDepthBook, LadderDepthBook) {
+    TestType book;
+    book.addOrder("s1", OrderType::SELL, 101, 5);
+    book.addOrder("s2", OrderType::SELL, 101, 7);
+    book.addOrder("s3", OrderType::SELL, 103, 2);
+    book.addOrder("b1", OrderType::BUY, 99, 4);
+
+    // Takes s1 and part of s2
+    book.addOrder("b2", OrderType::BUY, 101, 8);
+
+    std::array<DepthLevel, 4> asks{};
+    REQUIRE(book.getDepth(OrderType::SELL, asks) == 2);
+    REQUIRE(sameLevel(asks[0], 101, 4, 1));
+    REQUIRE(sameLevel(asks[1], 103, 2, 1));
+
+    // Crosses the rest of 101 and rests 6 of its 10 at 102
+    book.addOrder("b3", OrderType::BUY, 102, 10);
+    std::array<DepthLevel, 4> bids{};
+    REQUIRE(book.getDepth(OrderType::BUY, bids) == 2);
+    REQUIRE(sameLevel(bids[0], 102, 6, 1));
+    REQUIRE(sameLevel(bids[1], 99, 4, 1));
+
+    REQUIRE(book.cancel("b3"));
+    REQUIRE(book.getDepth(OrderType::BUY, bids) == 1);
+    REQUIRE(sameLevel(bids[0], 99, 4, 1));
+
+    // Asking for fewer levels than there are stops at the best ones
+    book.addOrder("s4", OrderType::SELL, 104, 1);
+    std::array<DepthLevel, 1> top{};
+    REQUIRE(book.getDepth(OrderType::SELL, top) == 1);
+    REQUIRE(sameLevel(top[0], 103, 2, 1));
+}
+
+TEMPLATE_TEST_CASE("Each operation reports every level it changed once, with its final state", "[Depth]",
+                   MapDepthBook, LadderDepthBook) {
+    TestType book;
+    auto& blocks = book.template observer<DeltaRecorder>().blocks;
+
+    book.addOrder("s1", OrderType::SELL, 100, 3);
+    book.addOrder("s2", OrderType::SELL, 100, 3);
+    book.addOrder("s3", OrderType::SELL, 101, 3);
+    REQUIRE(blocks.size() == 3);
+    REQUIRE(blocks[1].size() == 1);
+    REQUIRE(blocks[1][0].side == OrderType::SELL);
+    REQUIRE(sameLevel(blocks[1][0].level, 100, 6, 2));
+    REQUIRE(blocks[1][0].sequence == 2);
+
+    // Sweeps 100 and part of 101 and never rests, so its own side is never
+    // touched
+    blocks.clear();
+    book.addOrder("b1", OrderType::BUY, 101, 7);
+    REQUIRE(blocks.size() == 1);
+    const auto& sweep = blocks[0];
+    REQUIRE(sweep.size() == 2);
+    REQUIRE(sweep[0].side == OrderType::SELL);
+    REQUIRE(sameLevel(sweep[0].level, 100, 0, 0));
+    REQUIRE(sweep[1].side == OrderType::SELL);
+    REQUIRE(sameLevel(sweep[1].level, 101, 2, 1));
+    for (const auto& update : sweep) REQUIRE(update.sequence == 7);
+    REQUIRE(book.getSequence() == 7);
+
+    blocks.clear();
+    REQUIRE(book.cancel("s3"));
+    REQUIRE_FALSE(book.cancel("s3"));
+    REQUIRE(blocks.size() == 1);
+    REQUIRE(blocks[0].size() == 1);
+    REQUIRE(sameLevel(blocks[0][0].level, 101, 0, 0));
+}
+
+// Reports deltas to an OrderBook's dynamic observer
+struct DepthLog : IDepthObserver {
+    std::vector<LevelUpdate> updates;
+
+    void onLevelUpdates(std::span<const LevelUpdate> batch) override { updates.insert(updates.end(), batch.begin(), batch.end()); }
+};
+
+TEST_CASE("OrderBook depth agrees with its orders and feeds depth observers", "[Depth][OrderBook]") {
+    for (auto storage : {BookStorage::Map, BookStorage::Ladder}) {
+        OrderBook book{PriceScale{}, storage};
+        auto log = std::make_shared<DepthLog>();
+        book.addDepthObserver(log);
+
+        // Replaying the deltas onto a plain map must give the same book
+        std::map<std::pair<OrderType, Price>, DepthLevel> fromDeltas;
+
+        std::mt19937 rng(17);
+        std::vector<std::string> ids;
+        for (int i = 0; i < 2000; ++i) {
+            if (!ids.empty() && rng() % 4 == 0) {
+                const std::size_t pick = rng() % ids.size();
+                book.cancel(ids[pick]);
+                ids[pick] = ids.back();
+                ids.pop_back();
+            } else {
+                const OrderType side = rng() % 2 ? OrderType::BUY : OrderType::SELL;
+                const Price price = side == OrderType::BUY ? 990 + Price(rng() % 15) : 1000 - 5 + Price(rng() % 15);
+                ids.push_back("o" + std::to_string(i));
+                book.addOrder(ids.back(), side, price, 1 + static_cast<int>(rng() % 9));
+            }
+        }
+        for (const auto& update : log->updates) {
+            if (update.level.orderCount == 0) {
+                fromDeltas.erase({update.side, update.level.price});
+            } else {
+                fromDeltas[{update.side, update.level.price}] = update.level;
+            }
+        }
+
+        auto check = [&](OrderType side, const auto& orders) {
+            std::vector<DepthLevel> depth(orders.size() + 1);
+            REQUIRE(book.getDepth(side, depth) == orders.size());
+            std::size_t i = 0;
+            for (const auto& [price, queue] : orders) {
+                std::int64_t total = 0;
+                for (const auto& order : queue) total += order->getQuantity();
+                REQUIRE(sameLevel(depth[i], price, total, static_cast<std::uint32_t>(queue.size())));
+                const auto it = fromDeltas.find({side, price});
+                REQUIRE(it != fromDeltas.end());
+                REQUIRE(sameLevel(it->second, price, total, static_cast<std::uint32_t>(queue.size())));
+                ++i;
+            }
+        };
+        check(OrderType::BUY, book.getBuyOrders());
+        check(OrderType::SELL, book.getSellOrders());
+        REQUIRE(fromDeltas.size() == book.getBuyOrders().size() + book.getSellOrders().size());
+
+        // Detached observers hear nothing more
+        book.removeDepthObserver(log);
+        log->updates.clear();
+        book.addOrder("late", OrderType::BUY, 900, 1);
+        REQUIRE(log->updates.empty());
+    }
+}
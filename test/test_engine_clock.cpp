@@ -0,0 +1,122 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "OrderBook.hpp"
+#include "Engine/EngineClock.hpp"
+#include "Engine/Replay.hpp"
+#include "Observer/EventJournal.hpp"
+
+// ——————————————————————————————————————————
+// Engine clocks and message timestamps
+// ——————————————————————————————————————————
+
+namespace {
+    using TimePoint = std::chrono::system_clock::time_point;
+
+    struct StampRecorder {
+        std::vector<OrderEvent> events;
+
+        void onEvents(std::span<const OrderEvent> batch) { events.insert(events.end(), batch.begin(), batch.end()); }
+    };
+
+    struct StampLog : IOrderObserver {
+        std::vector<OrderEvent> events;
+        void onOrderEvent(const OrderEvent& ev) override { events.push_back(ev); }
+    };
+
+    TimePoint at(std::int64_t nanos) { return TimePoint{} + std::chrono::nanoseconds{nanos}; }
+}
+
+using StampBook = BasicOrderBook<PooledOrders, MapPrices, StampRecorder>;
+
+TEST_CASE("Every event of one message carries that message's time", "[EngineClock]") {
+    StampBook book;
+    book.setClock(EngineClock{ClockSource::Simulated, Stamping::PerMessage, at(1'000)});
+    for (int i = 0; i < 5; ++i) {
+        book.addOrder("s" + std::to_string(i), OrderType::SELL, 100 + i, 1);
+    }
+    REQUIRE(book.find("s0")->timestamp == at(1'000));
+
+    // One add sweeping five levels: an ADD and five trades, all at one time
+    auto& events = book.observer<StampRecorder>().events;
+    events.clear();
+    book.getClock().advance(std::chrono::nanoseconds{500});
+    book.addOrder("b", OrderType::BUY, 110, 6);
+    REQUIRE(events.size() == 6);
+    for (const auto& ev : events) REQUIRE(ev.timestamp == at(1'500));
+    REQUIRE(book.find("b")->timestamp == at(1'500));
+
+    book.getClock().set(at(2'000));
+    REQUIRE(book.modify("b", 2, 109));
+    REQUIRE(book.cancel("b"));
+    REQUIRE(events.back().timestamp == at(2'000));
+    REQUIRE(book.find("b") == nullptr);
+}
+
+TEST_CASE("Cycle-counter time tracks system_clock and never runs backwards", "[EngineClock]") {
+    TscClock tsc;
+    TimePoint previous = tsc.now();
+    const auto until = std::chrono::steady_clock::now() + 3 * TscClock::reanchorInterval;
+    while (std::chrono::steady_clock::now() < until) {
+        const TimePoint now = tsc.now();
+        REQUIRE(now >= previous);
+        previous = now;
+    }
+    const auto gap = std::chrono::system_clock::now() - tsc.now();
+    REQUIRE(std::chrono::abs(gap) < std::chrono::milliseconds{5});
+
+    // A book stamps a sweep once with it too
+    StampBook book;
+    REQUIRE(book.getClock().getSource() == ClockSource::Tsc);
+    book.addOrder("s1", OrderType::SELL, 100, 1);
+    book.addOrder("s2", OrderType::SELL, 101, 1);
+    auto& events = book.observer<StampRecorder>().events;
+    events.clear();
+    book.addOrder("b", OrderType::BUY, 101, 2);
+    REQUIRE(events.size() == 3);
+    REQUIRE(events[0].timestamp == events[2].timestamp);
+}
+
+TEST_CASE("Replay and recovery can keep the captured times", "[EngineClock][replay]") {
+    std::vector<OrderEvent> capture(3);
+    for (std::size_t i = 0; i < capture.size(); ++i) {
+        capture[i].type = OrderEventType::ADD;
+        capture[i].order.setId(std::to_string(i + 1));
+        capture[i].order.side = i < 2 ? OrderType::SELL : OrderType::BUY;
+        capture[i].order.price = 100;
+        capture[i].order.quantity = 1;
+        capture[i].timestamp = at(static_cast<std::int64_t>(1'000 * (i + 1)));
+    }
+
+    const std::string journalName = "clock_capture.journal";
+    {
+        OrderBook book;
+        auto log = std::make_shared<StampLog>();
+        auto journal = std::make_shared<EventJournal>(journalName);
+        book.addObserver(log);
+        book.addObserver(journal);
+        replay(book, capture, ReplayOptions{0, true});
+        journal->sync();
+
+        // The ADD and the trade it raised share the buy's captured time
+        REQUIRE(log->events.size() == 4);
+        REQUIRE(log->events[1].timestamp == at(2'000));
+        REQUIRE(log->events[2].timestamp == at(3'000));
+        REQUIRE(log->events[3].timestamp == at(3'000));
+        REQUIRE(book.getClock().getSource() == ClockSource::Tsc);
+    }
+
+    OrderBook recovered;
+    recovered.recover("clock_capture.snapshot", journalName);
+    REQUIRE(recovered.getOrderCount() == 1);
+    REQUIRE(recovered.find("2")->timestamp == at(2'000));
+    REQUIRE(recovered.getClock().getSource() == ClockSource::Tsc);
+    std::remove(journalName.c_str());
+}
@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Engine/SpscQueue.hpp"
+#include "Engine/EngineRunner.hpp"
+#include "BasicOrderBook.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// SpscQueue
+// ——————————————————————————————————————————
+
+TEST_CASE("SpscQueue is FIFO, bounded and wraps around", "[engine][queue]") {
+    SpscQueue<int> queue{3};
+    REQUIRE(queue.capacity() == 4);
+
+    int value = 0;
+    REQUIRE_FALSE(queue.tryPop(value));
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(queue.tryPush(round * 10 + i));
+        }
+        REQUIRE_FALSE(queue.tryPush(99));
+        for (int i = 0; i < 4; ++i) {
+            REQUIRE(queue.tryPop(value));
+            REQUIRE(value == round * 10 + i);
+        }
+        REQUIRE(queue.empty());
+    }
+}
+
+TEST_CASE("SpscQueue hands every value across threads in order", "[engine][queue]") {
+    constexpr int count = 100'000;
+    SpscQueue<int> queue{64};
+
+    std::thread producer([&] {
+        for (int i = 0; i < count; ++i) {
+            while (!queue.tryPush(i)) std::this_thread::yield();
+        }
+    });
+
+    int expected = 0;
+    int value = 0;
+    while (expected < count) {
+        if (queue.tryPop(value)) {
+            REQUIRE(value == expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    REQUIRE(queue.empty());
+}
+
+// ——————————————————————————————————————————
+// EngineRunner
+// ——————————————————————————————————————————
+
+// Collects the ids of trades, on the matching thread
+struct TradeIds {
+    std::vector<std::string> trades;
+
+    void onEvent(const OrderEvent& ev) {
+        if (ev.type == OrderEventType::MATCH) {
+            trades.push_back(std::string(ev.buyOrder().getId()) + "/" + std::string(ev.sellOrder().getId()));
+        }
+    }
+};
+
+TEST_CASE("EngineRunner applies commands in order and drains on stop", "[engine]") {
+    BasicOrderBook<PooledOrders, LadderPrices, TradeIds> book;
+    {
+        EngineRunner runner{book, RunnerOptions{8, Backpressure::Yield}};
+        for (int i = 0; i < 1000; ++i) {
+            const std::string n = std::to_string(i);
+            REQUIRE(runner.addOrder("s" + n, OrderType::SELL, 100 + i % 5, 1));
+            REQUIRE(runner.addOrder("b" + n, OrderType::BUY, 104, 1));
+        }
+        REQUIRE(runner.addOrder("rest", OrderType::SELL, 200, 1));
+        runner.stop();
+
+        REQUIRE(runner.getProcessedCount() == 2001);
+        REQUIRE(runner.getRejectedCount() == 0);
+    }
+
+    // Each buy takes out the sell submitted just before it
+    const auto& trades = book.observer<TradeIds>().trades;
+    REQUIRE(trades.size() == 1000);
+    REQUIRE(trades.front() == "b0/s0");
+    REQUIRE(trades.back() == "b999/s999");
+    REQUIRE(book.getOrderCount() == 1);
+}
+
+TEST_CASE("EngineRunner counts commands the book refuses", "[engine]") {
+    OrderBook book;
+    EngineRunner runner{book};
+
+    REQUIRE(runner.addOrder("a", OrderType::BUY, 10, 1));
+    REQUIRE(runner.addOrder("a", OrderType::BUY, 10, 1));   // duplicate id
+    REQUIRE(runner.addOrder("b", OrderType::BUY, 10, 0));   // no quantity
+    REQUIRE(runner.cancel("missing"));
+    REQUIRE(runner.cancel("a"));
+    runner.stop();
+
+    REQUIRE(runner.getProcessedCount() == 5);
+    REQUIRE(runner.getRejectedCount() == 3);
+    REQUIRE(book.getOrderCount() == 0);
+
+    // Ids that cannot be queued are refused on the producer's side
+    REQUIRE_THROWS_AS(OrderCommand::add(std::string(OrderSnapshot::maxIdLength + 1, 'x'), OrderType::BUY, 1, 1),
+                      std::invalid_argument);
+}
+
+TEST_CASE("EngineRunner with Reject backpressure fails fast when full", "[engine]") {
+    OrderBook book;
+    EngineRunner runner{book, RunnerOptions{2, Backpressure::Reject}};
+
+    // Whatever the full queue refused never reaches the book
+    int accepted = 0;
+    for (int i = 0; i < 10'000; ++i) {
+        accepted += runner.addOrder("o" + std::to_string(i), OrderType::BUY, 10, 1) ? 1 : 0;
+    }
+    runner.stop();
+
+    REQUIRE(static_cast<std::uint64_t>(accepted) == runner.getProcessedCount());
+    REQUIRE(book.getOrderCount() == static_cast<std::size_t>(accepted));
+}
@@ -0,0 +1,199 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "Engine/EngineRunner.hpp"
+#include "Events/JournalReader.hpp"
+#include "Observer/EventJournal.hpp"
+#include "Observer/TradeLog.hpp"
+
+namespace {
+    std::vector<std::string> readLines(const std::string& fname) {
+        std::ifstream in(fname);
+        std::vector<std::string> lines;
+        std::string line;
+        while (std::getline(in, line)) lines.push_back(line);
+        return lines;
+    }
+
+    std::vector<OrderEvent> readJournal(const std::string& fname) {
+        JournalReader reader{fname};
+        std::vector<OrderEvent> events;
+        OrderEvent ev;
+        while (reader.next(ev)) events.push_back(ev);
+        REQUIRE_FALSE(reader.truncated());
+        return events;
+    }
+}
+
+TEST_CASE("EventJournal round-trips to the TradeLog JSONL schema", "[journal]") {
+    const std::string binName = "journal_roundtrip.bin";
+    const std::string jsonName = "journal_roundtrip.jsonl";
+
+    {
+        OrderBook book;
+        auto journal = std::make_shared<EventJournal>(binName, 128);   // forces several drains
+        auto log = std::make_shared<TradeLog>(jsonName);
+        book.addObserver(journal);
+        book.addObserver(log);
+
+        // numeric, textual and zero-padded (not numeric) ids
+        book.addOrder("17", OrderType::SELL, 101, 5);
+        book.addOrder("alpha", OrderType::SELL, 102, 5);
+        book.addOrder("007", OrderType::BUY, 102, 7);
+        book.addOrder("alpha2", OrderType::BUY, 90, 1);
+        book.cancel("alpha2");
+        book.addOrder("18", OrderType::BUY, 95, 3);
+        journal->close();
+    }
+
+    const auto events = readJournal(binName);
+    REQUIRE(events.size() == 8);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        CHECK(events[i].sequence == i + 1);
+    }
+    CHECK(events[2].type == OrderEventType::ADD);
+    CHECK(events[2].order.getId() == "007");
+    CHECK(events[3].type == OrderEventType::MATCH);
+    CHECK(events[3].buyOrder().getId() == "007");
+    CHECK(events[3].sellOrder().getId() == "17");
+    CHECK(events[3].quantity == 5);
+
+    std::ostringstream converted;
+    for (const auto& ev : events) writeJsonLine(converted, ev);
+    std::vector<std::string> lines;
+    std::istringstream in(converted.str());
+    for (std::string line; std::getline(in, line);) lines.push_back(line);
+    CHECK(lines == readLines(jsonName));
+
+    std::remove(binName.c_str());
+    std::remove(jsonName.c_str());
+}
+
+TEST_CASE("One EventJournal numbers the events of several books in a single sequence", "[journal]") {
+    const std::string binName = "journal_shared.bin";
+    {
+        auto journal = std::make_shared<EventJournal>(binName);
+        OrderBook a, b;
+        a.addObserver(journal);
+        b.addObserver(journal);
+        a.addOrder("1", OrderType::BUY, 10, 1);
+        b.addOrder("1", OrderType::BUY, 10, 1);
+        a.cancel("1");
+        REQUIRE(journal->getLastSequence() == 3);
+    }
+
+    const auto events = readJournal(binName);
+    REQUIRE(events.size() == 3);
+    CHECK(events[2].type == OrderEventType::REMOVE);
+    CHECK(events[2].sequence == 3);
+
+    std::remove(binName.c_str());
+}
+
+TEST_CASE("JournalReader stops at a torn record and rejects other files", "[journal]") {
+    const std::string binName = "journal_torn.bin";
+    {
+        EventJournal journal{binName};
+        OrderEvent ev{};
+        ev.type = OrderEventType::ADD;
+        ev.order.setId("1");
+        journal.onOrderEvent(ev);
+        journal.onOrderEvent(ev);
+    }
+    std::filesystem::resize_file(binName, std::filesystem::file_size(binName) - 10);
+
+    JournalReader reader{binName};
+    OrderEvent ev;
+    REQUIRE(reader.next(ev));
+    REQUIRE_FALSE(reader.next(ev));
+    CHECK(reader.truncated());
+
+    CHECK(JournalReader::isJournal(binName));
+    {
+        std::ofstream text(binName);
+        text << "{\"type\":\"add\"}\n";
+    }
+    CHECK_FALSE(JournalReader::isJournal(binName));
+    CHECK_THROWS_AS(JournalReader{binName}, std::runtime_error);
+
+    std::remove(binName.c_str());
+}
+
+TEST_CASE("EventJournal writes out under its flush policy and bounds its interned ids", "[journal]") {
+    const std::string binName = "journal_policy.bin";
+    auto event = [](const std::string& id) {
+        OrderEvent ev{};
+        ev.type = OrderEventType::ADD;
+        ev.order.setId(id);
+        return ev;
+    };
+
+    SECTION("every N events") {
+        EventJournal journal{binName, EventJournal::defaultBufferSize, JournalOpen::Truncate,
+                             JournalFlushPolicy{3, std::chrono::hours{1}}};
+        journal.onOrderEvent(event("1"));
+        journal.onOrderEvent(event("2"));
+        CHECK(readJournal(binName).empty());
+        journal.onOrderEvent(event("3"));
+        CHECK(readJournal(binName).size() == 3);
+    }
+
+    SECTION("after the interval, even once events stop") {
+        auto journal = std::make_shared<EventJournal>(binName, EventJournal::defaultBufferSize, JournalOpen::Truncate,
+                                                      JournalFlushPolicy{4096, std::chrono::milliseconds{1}});
+        const auto headerSize = std::filesystem::file_size(binName);
+        OrderBook book;
+        book.addObserver(journal);
+
+        book.addOrder("1", OrderType::BUY, 100, 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        CHECK(readJournal(binName).empty());
+        book.idle();
+        CHECK(readJournal(binName).size() == 1);
+
+        // An EngineRunner idles its book while the queue is empty
+        EngineRunner<OrderBook> runner{book};
+        runner.addOrder("2", OrderType::BUY, 99, 1);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (std::filesystem::file_size(binName) < headerSize + 2 * sizeof(JournalEventRecord) &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        CHECK(std::filesystem::file_size(binName) >= headerSize + 2 * sizeof(JournalEventRecord));
+        runner.stop();
+        CHECK(readJournal(binName).size() == 2);
+    }
+
+    SECTION("text ids past the limit are interned afresh") {
+        const std::size_t count = EventJournal::maxInternedIds + 10;
+        {
+            EventJournal journal{binName};
+            for (std::size_t i = 0; i < count; ++i) journal.onOrderEvent(event("t" + std::to_string(i)));
+            journal.onOrderEvent(event("t0"));
+        }
+        {
+            // Continued journals never reuse an interned number
+            EventJournal journal{binName, EventJournal::defaultBufferSize, JournalOpen::Append};
+            journal.onOrderEvent(event("t5"));
+            journal.onOrderEvent(event("other"));
+        }
+        const auto events = readJournal(binName);
+        REQUIRE(events.size() == count + 3);
+        for (std::size_t i = 0; i < count; ++i) REQUIRE(events[i].order.getId() == "t" + std::to_string(i));
+        CHECK(events[count].order.getId() == "t0");
+        CHECK(events[count + 1].order.getId() == "t5");
+        CHECK(events[count + 2].order.getId() == "other");
+    }
+
+    std::remove(binName.c_str());
+}
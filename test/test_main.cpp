@@ -2,9 +2,7 @@
 #include "OrderBook.hpp"
 #include "OrderFactory.hpp"
 #include "Observer/TradeLog.hpp"
-#include "Events/AddOrderEvent.hpp"
-#include "Events/RemoveOrderEvent.hpp"
-#include "Events/TradeEvent.hpp"
+#include "Events/OrderEvent.hpp"
 
 TEST_CASE("Comprehensive OrderBook + TradeLog Integration", "[integration]") {
     // 1) Setup
@@ -60,63 +58,48 @@ TEST_CASE("Comprehensive OrderBook + TradeLog Integration", "[integration]") {
     REQUIRE(book.getSellOrders().empty());
 
     // 7) Verify the exact sequence of events in the TradeLog
-    auto &events = log->getEvents();
+    const auto events = log->getEvents();
     REQUIRE(events.size() == 8);
-
-    // 0: AddOrderEvent(B1)
-    REQUIRE(events[0]->getEventType() == OrderEventType::ADD);
-    {
-        auto *e = dynamic_cast<AddOrderEvent*>(events[0].get());
-        REQUIRE(e->getOrder()->getId() == B1->getId());
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        REQUIRE(events[i].sequence == i + 1);
     }
 
-    // 1: AddOrderEvent(B2)
-    REQUIRE(events[1]->getEventType() == OrderEventType::ADD);
-    {
-        auto *e = dynamic_cast<AddOrderEvent*>(events[1].get());
-        REQUIRE(e->getOrder()->getId() == B2->getId());
-    }
+    // 0: ADD(B1)
+    REQUIRE(events[0].type == OrderEventType::ADD);
+    REQUIRE(events[0].order.getId() == B1->getId());
 
-    // 2: AddOrderEvent(S1)
-    REQUIRE(events[2]->getEventType() == OrderEventType::ADD);
-    {
-        auto *e = dynamic_cast<AddOrderEvent*>(events[2].get());
-        REQUIRE(e->getOrder()->getId() == S1->getId());
-    }
+    // 1: ADD(B2)
+    REQUIRE(events[1].type == OrderEventType::ADD);
+    REQUIRE(events[1].order.getId() == B2->getId());
 
-    // 3 & 4: TradeEvent(B2↔S1 qty=2, B1↔S1 qty=1)
-    REQUIRE(events[3]->getEventType() == OrderEventType::MATCH);
-    REQUIRE(events[4]->getEventType() == OrderEventType::MATCH);
-    {
-        auto *t1 = dynamic_cast<TradeEvent*>(events[3].get());
-        REQUIRE(t1->getBuyOrder()->getId()  == B2->getId());
-        REQUIRE(t1->getSellOrder()->getId() == S1->getId());
-        REQUIRE(t1->getQty()               == 2);
-
-        auto *t2 = dynamic_cast<TradeEvent*>(events[4].get());
-        REQUIRE(t2->getBuyOrder()->getId()  == B1->getId());
-        REQUIRE(t2->getSellOrder()->getId() == S1->getId());
-        REQUIRE(t2->getQty()               == 1);
-    }
+    // 2: ADD(S1)
+    REQUIRE(events[2].type == OrderEventType::ADD);
+    REQUIRE(events[2].order.getId() == S1->getId());
 
-    // 5: AddOrderEvent(S2)
-    REQUIRE(events[5]->getEventType() == OrderEventType::ADD);
+    // 3 & 4: MATCH(B2↔S1 qty=2, B1↔S1 qty=1)
+    REQUIRE(events[3].type == OrderEventType::MATCH);
+    REQUIRE(events[4].type == OrderEventType::MATCH);
     {
-        auto *e = dynamic_cast<AddOrderEvent*>(events[5].get());
-        REQUIRE(e->getOrder()->getId() == S2->getId());
+        const auto& t1 = events[3];
+        REQUIRE(t1.buyOrder().getId()  == B2->getId());
+        REQUIRE(t1.sellOrder().getId() == S1->getId());
+        REQUIRE(t1.quantity            == 2);
+
+        const auto& t2 = events[4];
+        REQUIRE(t2.buyOrder().getId()  == B1->getId());
+        REQUIRE(t2.sellOrder().getId() == S1->getId());
+        REQUIRE(t2.quantity            == 1);
     }
 
-    // 6: RemoveOrderEvent(B1)
-    REQUIRE(events[6]->getEventType() == OrderEventType::REMOVE);
-    {
-        auto *e = dynamic_cast<RemoveOrderEvent*>(events[6].get());
-        REQUIRE(e->getOrder()->getId() == B1->getId());
-    }
+    // 5: ADD(S2)
+    REQUIRE(events[5].type == OrderEventType::ADD);
+    REQUIRE(events[5].order.getId() == S2->getId());
 
-    // 7: RemoveOrderEvent(S2)
-    REQUIRE(events[7]->getEventType() == OrderEventType::REMOVE);
-    {
-        auto *e = dynamic_cast<RemoveOrderEvent*>(events[7].get());
-        REQUIRE(e->getOrder()->getId() == S2->getId());
-    }
+    // 6: REMOVE(B1)
+    REQUIRE(events[6].type == OrderEventType::REMOVE);
+    REQUIRE(events[6].order.getId() == B1->getId());
+
+    // 7: REMOVE(S2)
+    REQUIRE(events[7].type == OrderEventType::REMOVE);
+    REQUIRE(events[7].order.getId() == S2->getId());
 }
@@ -9,8 +9,8 @@
 // ——————————————————————————————————————————
 // Map aliases matching your engine signature
 // ——————————————————————————————————————————
-using BuyBook  = std::map<double, std::deque<std::shared_ptr<IOrder>>, std::greater<>>;
-using SellBook = std::map<double, std::deque<std::shared_ptr<IOrder>>>;
+using BuyBook  = std::map<Price, std::deque<std::shared_ptr<IOrder>>, std::greater<>>;
+using SellBook = std::map<Price, std::deque<std::shared_ptr<IOrder>>>;
 
 // Helper to sum quantities (if needed)
 static int totalQuantity(const SellBook& b) {
@@ -146,3 +146,44 @@ TEST_CASE("Empty opposing book yields no trades", "[match][empty]") {
     REQUIRE(trades.empty());
     REQUIRE(sellBook.empty());
 }
+
+TEST_CASE("Filled incoming order leaves its own book without touching other levels", "[match][cleanup]") {
+    BuyBook  buyBook;
+    SellBook sellBook;
+
+    auto restingBid = OrderFactory::createLimitOrder(3, 90, OrderType::BUY);
+    buyBook[90].push_back(restingBid);
+
+    auto sell = OrderFactory::createLimitOrder(5, 100, OrderType::SELL);
+    sellBook[100].push_back(sell);
+
+    // The incoming order sits at the back of its own level, as OrderBook does it
+    auto buy = OrderFactory::createLimitOrder(5, 100, OrderType::BUY);
+    buyBook[100].push_back(buy);
+
+    auto trades = MatchingEngine::match(buy, buyBook, sellBook);
+
+    REQUIRE(trades.size() == 1);
+    REQUIRE(sellBook.empty());
+    REQUIRE(buyBook.size() == 1);
+    REQUIRE(buyBook.begin()->first == 90);
+    REQUIRE(buyBook.at(90).front()->getId() == restingBid->getId());
+}
+
+TEST_CASE("Partially filled incoming order keeps resting in its own book", "[match][partial]") {
+    BuyBook  buyBook;
+    SellBook sellBook;
+
+    sellBook[100].push_back(
+      OrderFactory::createLimitOrder(2, 100, OrderType::SELL));
+
+    auto buy = OrderFactory::createLimitOrder(5, 100, OrderType::BUY);
+    buyBook[100].push_back(buy);
+
+    auto trades = MatchingEngine::match(buy, buyBook, sellBook);
+
+    REQUIRE(trades.size() == 1);
+    REQUIRE(sellBook.empty());
+    REQUIRE(buyBook.at(100).size() == 1);
+    REQUIRE(buyBook.at(100).front()->getQuantity() == 3);
+}
@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <chrono>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "BasicOrderBook.hpp"
+#include "LimitOrder.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Modify: in-place reductions and moves
+// ——————————————————————————————————————————
+
+struct ModifyRecorder {
+    std::vector<OrderEvent> events;
+
+    void onEvents(std::span<const OrderEvent> batch) { events.insert(events.end(), batch.begin(), batch.end()); }
+};
+
+using MapModifyBook    = BasicOrderBook<PooledOrders, MapPrices, ModifyRecorder>;
+using LadderModifyBook = BasicOrderBook<PooledOrders, LadderPrices, ModifyRecorder>;
+
+// Ids resting at one level of a side, front to back
+template <typename Book>
+static std::vector<std::string> queueAt(const Book& book, OrderType side, Price price) {
+    std::vector<std::string> ids;
+    book.forEachLevel(side, [&](const LevelView<typename Book::Node>& level) {
+        if (level.price() != price) return;
+        for (const auto& order : level) ids.push_back(order.getId());
+    });
+    return ids;
+}
+
+TEMPLATE_TEST_CASE("Lowering only the quantity keeps the order's place", "[Modify]", MapModifyBook, LadderModifyBook) {
+    TestType book;
+    book.addOrder("a", OrderType::SELL, 100, 5);
+    book.addOrder("b", OrderType::SELL, 100, 5);
+    auto& events = book.template observer<ModifyRecorder>().events;
+    events.clear();
+
+    REQUIRE(book.modify("a", 2, 100));
+    REQUIRE(queueAt(book, OrderType::SELL, 100) == std::vector<std::string>{"a", "b"});
+    REQUIRE(book.getBestAsk() == DepthLevel{100, 7, 2});
+
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].type == OrderEventType::MODIFY);
+    REQUIRE(events[0].order.getId() == "a");
+    REQUIRE(events[0].order.quantity == 2);
+    REQUIRE(events[0].contra.quantity == 5);
+    REQUIRE(events[0].quantity == 2);
+
+    // a still trades first
+    book.addOrder("x", OrderType::BUY, 100, 3);
+    REQUIRE(queueAt(book, OrderType::SELL, 100) == std::vector<std::string>{"b"});
+    REQUIRE(book.getBestAsk() == DepthLevel{100, 4, 1});
+}
+
+TEMPLATE_TEST_CASE("A larger quantity or a new price sends the order to the back", "[Modify]",
+                   MapModifyBook, LadderModifyBook) {
+    TestType book;
+    book.addOrder("a", OrderType::BUY, 90, 1);
+    book.addOrder("b", OrderType::BUY, 90, 1);
+    book.addOrder("c", OrderType::BUY, 89, 1);
+    auto& events = book.template observer<ModifyRecorder>().events;
+    events.clear();
+
+    REQUIRE(book.modify("a", 4, 90));
+    REQUIRE(queueAt(book, OrderType::BUY, 90) == std::vector<std::string>{"b", "a"});
+    REQUIRE(book.getBestBid() == DepthLevel{90, 5, 2});
+
+    // Moving to another level empties the old one if it was alone there
+    REQUIRE(book.modify("c", 1, 90));
+    REQUIRE(queueAt(book, OrderType::BUY, 90) == std::vector<std::string>{"b", "a", "c"});
+    REQUIRE(queueAt(book, OrderType::BUY, 89).empty());
+
+    // So does a new price alone
+    REQUIRE(book.modify("b", 1, 91));
+    REQUIRE(book.getBestBid() == DepthLevel{91, 1, 1});
+
+    REQUIRE(events.size() == 3);
+    for (const auto& ev : events) REQUIRE(ev.type == OrderEventType::MODIFY);
+    REQUIRE(events[1].contra.price == 89);
+    REQUIRE(events[1].order.price == 90);
+    REQUIRE(book.getOrderCount() == 3);
+}
+
+TEMPLATE_TEST_CASE("A modify that crosses trades like an incoming order", "[Modify]", MapModifyBook, LadderModifyBook) {
+    TestType book;
+    book.addOrder("s1", OrderType::SELL, 101, 2);
+    book.addOrder("s2", OrderType::SELL, 102, 2);
+    book.addOrder("b1", OrderType::BUY, 99, 3);
+    book.addOrder("b2", OrderType::BUY, 98, 1);
+    auto& events = book.template observer<ModifyRecorder>().events;
+    events.clear();
+
+    // Takes s1, rests 1 at 101
+    REQUIRE(book.modify("b1", 3, 101));
+    REQUIRE(events.size() == 2);
+    REQUIRE(events[0].type == OrderEventType::MODIFY);
+    REQUIRE(events[1].type == OrderEventType::MATCH);
+    REQUIRE(events[1].buyOrder().getId() == "b1");
+    REQUIRE(events[1].sellOrder().getId() == "s1");
+    REQUIRE(events[1].quantity == 2);
+    REQUIRE(book.getBestBid() == DepthLevel{101, 1, 1});
+    REQUIRE(book.getBestAsk() == DepthLevel{102, 2, 1});
+
+    // Filled in full: the order leaves the book
+    REQUIRE(book.modify("b2", 2, 102));
+    REQUIRE(book.getOrderCount() == 1);
+    REQUIRE_FALSE(book.cancel("b2"));
+    REQUIRE_FALSE(book.getTopOfBook().hasAsk());
+}
+
+TEMPLATE_TEST_CASE("Modify refuses what it cannot do and leaves the order alone", "[Modify]",
+                   MapModifyBook, LadderModifyBook) {
+    TestType book;
+    book.addOrder("a", OrderType::SELL, 100, 5);
+    auto& events = book.template observer<ModifyRecorder>().events;
+    events.clear();
+
+    REQUIRE_FALSE(book.modify("missing", 1, 100));
+    REQUIRE_THROWS_AS(book.modify("a", 0, 100), std::invalid_argument);
+    REQUIRE(book.modify("a", 5, 100));   // changes nothing
+    REQUIRE(events.empty());
+    REQUIRE(book.getBestAsk() == DepthLevel{100, 5, 1});
+}
+
+TEST_CASE("Modify past the ladder's range throws and keeps the order", "[Modify]") {
+    BasicOrderBook<PooledOrders, LadderPrices> book{PriceScale{}, LadderPrices{8, 8}};
+    book.addOrder("a", OrderType::SELL, 100, 5);
+    book.addOrder("b", OrderType::SELL, 104, 5);
+    REQUIRE_THROWS_AS(book.modify("a", 5, 120), std::length_error);
+    REQUIRE(book.getBestAsk() == DepthLevel{100, 5, 1});
+    REQUIRE(book.getOrderCount() == 2);
+}
+
+TEST_CASE("OrderBook::modify mirrors reductions into the IOrder until the order moves", "[Modify][OrderBook]") {
+    OrderBook book;
+    const auto now = std::chrono::system_clock::now();
+    auto order = std::make_shared<LimitOrder>("a", OrderType::BUY, 50, 10, now);
+    book.addOrder(order);
+
+    REQUIRE(book.modify("a", 6, 50));
+    REQUIRE(order->getQuantity() == 6);
+
+    REQUIRE(book.modify("a", 8, 51));
+    REQUIRE(order->getQuantity() == 6);
+    const auto bids = book.getBuyOrders();
+    REQUIRE(bids.at(51).front()->getQuantity() == 8);
+    REQUIRE(bids.at(51).front() != order);
+}
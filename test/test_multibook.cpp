@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Engine/MultiBookEngine.hpp"
+#include "OrderBook.hpp"
+
+namespace {
+    std::vector<std::string> makeSymbols(int count) {
+        std::vector<std::string> symbols;
+        for (int i = 0; i < count; ++i) {
+            symbols.push_back("SYM" + std::to_string(i));
+        }
+        return symbols;
+    }
+
+    // Counts trades for one book, on its shard's thread
+    struct TradeCount : IOrderObserver {
+        int trades = 0;
+        void onOrderEvent(const OrderEvent& ev) override {
+            if (ev.type == OrderEventType::MATCH) ++trades;
+        }
+    };
+}
+
+TEST_CASE("MultiBookEngine spreads symbols evenly across shards", "[engine][multibook]") {
+    const auto symbols = makeSymbols(10);
+    MultiBookEngine<> engine{symbols, EngineOptions{3, RunnerOptions{}}};
+
+    REQUIRE(engine.getShardCount() == 3);
+    REQUIRE(engine.getSymbolCount() == 10);
+    std::vector<int> perShard(3);
+    for (const auto& symbol : symbols) {
+        ++perShard[engine.shardOf(symbol)];
+    }
+    REQUIRE(perShard == std::vector<int>{4, 3, 3});
+
+    REQUIRE_THROWS_AS(engine.book("NOPE"), std::invalid_argument);
+    REQUIRE_THROWS_AS((MultiBookEngine<>{{"A", "B", "A"}}), std::invalid_argument);
+}
+
+TEST_CASE("MultiBookEngine routes each symbol's orders to its own book", "[engine][multibook]") {
+    const auto symbols = makeSymbols(8);
+    MultiBookEngine<> engine{symbols, EngineOptions{4, RunnerOptions{16, Backpressure::Yield}}};
+
+    std::vector<std::shared_ptr<TradeCount>> counts;
+    for (const auto& symbol : symbols) {
+        counts.push_back(std::make_shared<TradeCount>());
+        engine.book(symbol).addObserver(counts.back());
+    }
+
+    engine.start();
+    REQUIRE(engine.running());
+    // The same order ids on every symbol: books are independent
+    for (int round = 0; round < 50; ++round) {
+        for (std::size_t s = 0; s < symbols.size(); ++s) {
+            const std::string n = std::to_string(round);
+            REQUIRE(engine.addOrder(symbols[s], "ask" + n, OrderType::SELL, 100, 2));
+            // only even symbols trade
+            if (s % 2 == 0) {
+                REQUIRE(engine.addOrder(symbols[s], "bid" + n, OrderType::BUY, 100, 2));
+            }
+        }
+    }
+    REQUIRE(engine.cancel(symbols[1], "ask0"));
+    REQUIRE(engine.cancel(symbols[1], "missing"));
+    REQUIRE_THROWS_AS(engine.addOrder("NOPE", "x", OrderType::BUY, 1, 1), std::invalid_argument);
+    engine.stop();
+    REQUIRE_FALSE(engine.running());
+
+    REQUIRE(engine.getProcessedCount() == 8 * 50 + 4 * 50 + 2);
+    REQUIRE(engine.getRejectedCount() == 1);
+    for (std::size_t s = 0; s < symbols.size(); ++s) {
+        auto& book = engine.book(symbols[s]);
+        if (s % 2 == 0) {
+            REQUIRE(counts[s]->trades == 50);
+            REQUIRE(book.getOrderCount() == 0);
+        } else {
+            REQUIRE(counts[s]->trades == 0);
+            REQUIRE(book.getOrderCount() == (s == 1 ? 49u : 50u));
+        }
+    }
+}
+
+TEST_CASE("MultiBookEngine batches per book and queues nothing while stopped", "[engine][multibook]") {
+    MultiBookEngine<> engine{{"A", "B"}, EngineOptions{1, RunnerOptions{1024, Backpressure::Yield, -1, 64}}};
+    auto a = std::make_shared<TradeCount>();
+    auto b = std::make_shared<TradeCount>();
+    engine.book("A").addObserver(a);
+    engine.book("B").addObserver(b);
+
+    REQUIRE_FALSE(engine.addOrder("A", "early", OrderType::SELL, 100, 1));
+
+    engine.start();
+    for (int i = 0; i < 100; ++i) {
+        const std::string n = std::to_string(i);
+        // Runs of commands for one book, interleaved with the other's
+        REQUIRE(engine.addOrder("A", "ask" + n, OrderType::SELL, 100, 1));
+        REQUIRE(engine.addOrder("A", "bid" + n, OrderType::BUY, 100, 1));
+        REQUIRE(engine.addOrder("B", "ask" + n, OrderType::SELL, 100, 1));
+    }
+    REQUIRE(engine.cancel("B", "missing"));
+    engine.stop();
+
+    REQUIRE_FALSE(engine.addOrder("A", "late", OrderType::SELL, 100, 1));
+    REQUIRE(engine.getProcessedCount() == 301);
+    REQUIRE(engine.getRejectedCount() == 1);
+    REQUIRE(a->trades == 100);
+    REQUIRE(b->trades == 0);
+    REQUIRE(engine.book("A").getOrderCount() == 0);
+    REQUIRE(engine.book("B").getOrderCount() == 100);
+}
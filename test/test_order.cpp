@@ -5,7 +5,7 @@
 TEST_CASE("LimitOrder correctly stores and returns its values", "[order]") {
      std::string id = "101";
     OrderType type = OrderType::BUY;
-    double price = 99.5;
+    Price price = 9950;   // 99.50 with a 0.01 tick
     int quantity = 10;
     std::chrono::system_clock::time_point timestamp = std::chrono::system_clock::now();
 
@@ -13,13 +13,13 @@ TEST_CASE("LimitOrder correctly stores and returns its values", "[order]") {
 
     REQUIRE(order.getId() == id);
     REQUIRE(order.getType() == OrderType::BUY);
-    REQUIRE(order.getPrice() == 99.5);
+    REQUIRE(order.getPrice() == 9950);
     REQUIRE(order.getQuantity() == 10);
     REQUIRE(order.getTimestamp() == timestamp);
 }
 
 TEST_CASE("LimitOrder handles SELL type correctly", "[order]") {
-    LimitOrder order("202", OrderType::SELL, 120.25, 5, std::chrono::system_clock::now());
+    LimitOrder order("202", OrderType::SELL, 12025, 5, std::chrono::system_clock::now());
 
     REQUIRE(order.getType() == OrderType::SELL);
     REQUIRE(order.getPrice() > 0);
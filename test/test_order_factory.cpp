@@ -2,8 +2,11 @@
 #include <memory>
 #include "OrderFactory.hpp"
 #include "LimitOrder.hpp"
+#include <algorithm>
 #include <chrono>
+#include <set>
 #include <thread>
+#include <vector>
 
 TEST_CASE("OrderFactory creates orders with correct attributes", "[OrderFactory]") {
     auto order1 = OrderFactory::createLimitOrder(100, 50, OrderType::BUY);
@@ -37,3 +40,29 @@ TEST_CASE("OrderFactory timestamps are correctly set", "[OrderFactory]") {
     REQUIRE(timestamp >= before);
     REQUIRE(timestamp <= after);
 }
+
+TEST_CASE("OrderFactory ids are unique across threads and increase within each", "[OrderFactory]") {
+    constexpr int threads = 4;
+    constexpr int perThread = 20'000;
+    std::vector<std::vector<OrderId>> ids(threads);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&ids, t] {
+            for (int i = 0; i < perThread; ++i) ids[t].push_back(OrderFactory::nextId());
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    std::set<OrderId> all;
+    for (const auto& mine : ids) {
+        REQUIRE(std::is_sorted(mine.begin(), mine.end()));
+        all.insert(mine.begin(), mine.end());
+    }
+    REQUIRE(all.size() == threads * perThread);
+
+    // Skipping ahead also drops the block this thread holds
+    const OrderId floor = *all.rbegin() + 1'000'000;
+    OrderFactory::skipIdsBelow(floor);
+    REQUIRE(OrderFactory::nextId() >= floor);
+    REQUIRE(std::stoull(OrderFactory::createLimitOrder(1, 1, OrderType::BUY)->getId()) > floor);
+}
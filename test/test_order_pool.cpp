@@ -0,0 +1,251 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cstdlib>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Book/OrderIndex.hpp"
+#include "Book/OrderPool.hpp"
+#include "Book/OrderPolicies.hpp"
+#include "OrderBook.hpp"
+#include "Events/OrderEvent.hpp"
+
+// ——————————————————————————————————————————
+// Counting allocator: every global operator new in this binary is counted.
+// All the plain forms are replaced together (scalar and array, sized and
+// nothrow) so every new is paired with a matching delete.
+// ——————————————————————————————————————————
+
+static std::size_t allocationCount = 0;
+
+static void* countedAllocate(std::size_t size) noexcept {
+    ++allocationCount;
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new(std::size_t size) {
+    if (void* p = countedAllocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if (void* p = countedAllocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept   { return countedAllocate(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return countedAllocate(size); }
+
+// Out of line so GCC does not see free() applied to what it takes for a new
+// expression's result (-Wmismatched-new-delete)
+[[gnu::noinline]] static void releaseAllocation(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p) noexcept                             { releaseAllocation(p); }
+void operator delete[](void* p) noexcept                           { releaseAllocation(p); }
+void operator delete(void* p, std::size_t) noexcept                { releaseAllocation(p); }
+void operator delete[](void* p, std::size_t) noexcept              { releaseAllocation(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept      { releaseAllocation(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept    { releaseAllocation(p); }
+
+// Passive quoting on both sides, cancels from the middle of busy levels and
+// marketable orders that sweep several levels. Leaves the book empty, so the
+// same workload can be replayed against a warmed-up book.
+static void runWorkload(OrderBook& book, const std::vector<std::string>& ids) {
+    std::size_t next = 0;
+    for (int round = 0; round < 20; ++round) {
+        const std::size_t first = next;
+        for (Price p = 100; p < 110; ++p) {
+            book.addOrder(ids[next++], OrderType::SELL, p, 5);
+            book.addOrder(ids[next++], OrderType::SELL, p, 5);
+            book.addOrder(ids[next++], OrderType::BUY,  p - 20, 5);
+        }
+        // cancel every third order, then take out the first four ask levels
+        for (std::size_t i = first; i < next; i += 3) {
+            book.cancel(ids[i]);
+        }
+        book.addOrder(ids[next++], OrderType::BUY, 103, 30);
+        book.addOrder(ids[next++], OrderType::SELL, 85, 12);
+        // clear whatever is left
+        for (std::size_t i = first; i < next; ++i) {
+            book.cancel(ids[i]);
+        }
+    }
+}
+
+TEST_CASE("Steady-state add, match and cancel do not allocate", "[pool][alloc]") {
+    auto storage = GENERATE(BookStorage::Map, BookStorage::Ladder);
+    OrderBook book{PriceScale{}, storage, 1024};
+
+    std::vector<std::string> ids;
+    for (int i = 0; i < 20 * 32; ++i) {
+        ids.push_back("o" + std::to_string(i));
+    }
+
+    // Warm up the pool, the id index and the level storage
+    runWorkload(book, ids);
+    REQUIRE(book.getOrderCount() == 0);
+
+    const std::size_t before = allocationCount;
+    runWorkload(book, ids);
+    const std::size_t allocations = allocationCount - before;
+
+    REQUIRE(allocations == 0);
+    REQUIRE(book.getOrderCount() == 0);
+    REQUIRE(book.getBuyOrders().empty());
+    REQUIRE(book.getSellOrders().empty());
+}
+
+// Counts events without keeping them
+struct EventCounter : IOrderObserver {
+    std::size_t events = 0;
+    void onOrderEvent(const OrderEvent&) override { ++events; }
+};
+
+TEST_CASE("Delivering events to observers does not allocate", "[pool][alloc]") {
+    auto storage = GENERATE(BookStorage::Map, BookStorage::Ladder);
+    OrderBook book{PriceScale{}, storage, 1024};
+    auto counter = std::make_shared<EventCounter>();
+    book.addObserver(counter);
+
+    std::vector<std::string> ids;
+    for (int i = 0; i < 20 * 32; ++i) {
+        ids.push_back("o" + std::to_string(i));
+    }
+
+    // Also warms up the event buffers
+    runWorkload(book, ids);
+    const std::size_t warmupEvents = counter->events;
+
+    const std::size_t before = allocationCount;
+    runWorkload(book, ids);
+    const std::size_t allocations = allocationCount - before;
+
+    REQUIRE(allocations == 0);
+    REQUIRE(counter->events == 2 * warmupEvents);
+}
+
+// ——————————————————————————————————————————
+// OrderPool
+// ——————————————————————————————————————————
+
+using Pool = OrderPool<PooledOrders::Node>;
+
+TEST_CASE("OrderPool recycles released slots before growing", "[pool]") {
+    Pool pool{8};
+    REQUIRE(pool.capacity() == Pool::slabSize);
+
+    PooledOrders::Node& a = pool.acquire();
+    PooledOrders::Node& b = pool.acquire();
+    REQUIRE(a.handle != b.handle);
+    REQUIRE(&pool[a.handle] == &a);
+    REQUIRE(pool.size() == 2);
+
+    const OrderHandle freed = a.handle;
+    pool.release(a);
+    REQUIRE(pool.acquire().handle == freed);
+    REQUIRE(pool.size() == 2);
+}
+
+TEST_CASE("OrderPool grows by whole slabs without moving live nodes", "[pool]") {
+    Pool pool{1};
+    std::vector<PooledOrders::Node*> nodes;
+    for (std::size_t i = 0; i < Pool::slabSize + 1; ++i) {
+        nodes.push_back(&pool.acquire());
+        nodes.back()->quantity = static_cast<int>(i);
+    }
+
+    REQUIRE(pool.capacity() == 2 * Pool::slabSize);
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        REQUIRE(&pool[nodes[i]->handle] == nodes[i]);
+        REQUIRE(nodes[i]->quantity == static_cast<int>(i));
+    }
+}
+
+TEST_CASE("OrderIndex finds every entry through churn, growth and shared keys", "[pool][index]") {
+    OrderIndex index{4};
+    std::map<OrderHandle, OrderId> live;
+    std::mt19937_64 rng{11};
+
+    // Sequential numeric keys, plus hashed keys that collide in groups of four
+    auto keyFor = [](OrderHandle handle) {
+        return handle % 3 ? OrderId{handle} : (textKeyBit | (handle / 4));
+    };
+    for (int step = 0; step < 50'000; ++step) {
+        const OrderHandle handle = static_cast<OrderHandle>(rng() % 3000);
+        if (live.count(handle)) {
+            index.erase(live[handle], handle);
+            live.erase(handle);
+        } else {
+            index.insert(keyFor(handle), handle);
+            live[handle] = keyFor(handle);
+        }
+    }
+
+    REQUIRE(index.size() == live.size());
+    for (OrderHandle handle = 0; handle < 3000; ++handle) {
+        const OrderHandle found = index.find(keyFor(handle), [&](OrderHandle h) { return h == handle; });
+        REQUIRE(found == (live.count(handle) ? handle : nullHandle));
+    }
+}
+
+// ——————————————————————————————————————————
+// Pooled orders through the book
+// ——————————————————————————————————————————
+
+struct PoolRecorder : IOrderObserver {
+    std::vector<OrderEvent> receivedEvents;
+    void onOrderEvent(const OrderEvent& ev) override {
+        receivedEvents.push_back(ev);
+    }
+};
+
+TEST_CASE("Pooled orders match and report like IOrder-backed ones", "[pool][OrderBook]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
+    auto obs = std::make_shared<PoolRecorder>();
+    book.addObserver(obs);
+
+    book.addOrder("ask-1", OrderType::SELL, 100, 4);
+    book.addOrder("bid-1", OrderType::BUY,  101, 6);
+
+    REQUIRE(obs->receivedEvents.size() == 3);
+    const auto& add = obs->receivedEvents[0];
+    REQUIRE(add.type == OrderEventType::ADD);
+    REQUIRE(add.order.getId() == "ask-1");
+    REQUIRE(add.order.quantity == 4);
+
+    const auto& trade = obs->receivedEvents[2];
+    REQUIRE(trade.type == OrderEventType::MATCH);
+    REQUIRE(trade.buyOrder().getId()  == "bid-1");
+    REQUIRE(trade.sellOrder().getId() == "ask-1");
+    REQUIRE(trade.quantity == 4);
+
+    // The buy remainder rests in the pool
+    REQUIRE(book.getOrderCount() == 1);
+    auto bids = book.getBuyOrders();
+    REQUIRE(bids.at(101).front()->getId() == "bid-1");
+    REQUIRE(bids.at(101).front()->getQuantity() == 2);
+
+    REQUIRE(book.cancel("bid-1"));
+    REQUIRE(book.getOrderCount() == 0);
+}
+
+TEST_CASE("Rejected orders give their pool slot back", "[pool][OrderBook]") {
+    OrderBook book;
+    book.addOrder("x", OrderType::BUY, 10, 1);
+
+    REQUIRE_THROWS_AS(book.addOrder("x", OrderType::SELL, 20, 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(book.addOrder("y", OrderType::SELL, 20, 0), std::invalid_argument);
+    REQUIRE_THROWS_AS(book.addOrder(std::string(OrderSnapshot::maxIdLength + 1, 'z'), OrderType::SELL, 20, 1),
+                      std::invalid_argument);
+    REQUIRE(book.getOrderCount() == 1);
+    REQUIRE(book.getSellOrders().empty());
+}
@@ -1,31 +1,29 @@
 // test/test_orderbook_events.cpp
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <memory>
 #include <vector>
 
 #include "OrderBook.hpp"
 #include "OrderFactory.hpp"
-#include "Interfaces/IEvent.hpp"
-#include "Events/AddOrderEvent.hpp"
-#include "Events/RemoveOrderEvent.hpp"
-#include "Events/TradeEvent.hpp"
+#include "Events/OrderEvent.hpp"
 
 struct RecordingObserver : IOrderObserver {
-    std::vector<std::shared_ptr<IEvent>> receivedEvents;
-    void onOrderEvent(std::shared_ptr<IEvent> ev) override {
-        receivedEvents.push_back(std::move(ev));
+    std::vector<OrderEvent> receivedEvents;
+    void onOrderEvent(const OrderEvent& ev) override {
+        receivedEvents.push_back(ev);
     }
 };
 
-static int countType(const std::vector<std::shared_ptr<IEvent>>& evs, OrderEventType type) {
+static int countType(const std::vector<OrderEvent>& evs, OrderEventType type) {
     return std::count_if(evs.begin(), evs.end(),
-        [&](auto& e){ return e->getEventType()==type; });
+        [&](auto& e){ return e.type==type; });
 }
 
-TEST_CASE("AddOrder emits one AddOrderEvent", "[OrderBook]") {
-    OrderBook book;
+TEST_CASE("AddOrder emits one ADD event", "[OrderBook]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
     auto obs = std::make_shared<RecordingObserver>();
     book.addObserver(obs);
 
@@ -34,13 +32,15 @@ TEST_CASE("AddOrder emits one AddOrderEvent", "[OrderBook]") {
 
     REQUIRE(obs->receivedEvents.size() == 1);
     REQUIRE(countType(obs->receivedEvents, OrderEventType::ADD) == 1);
-    auto ev = std::dynamic_pointer_cast<AddOrderEvent>(obs->receivedEvents[0]);
-    REQUIRE(ev);
-    REQUIRE(ev->getOrder()->getId() == o->getId());
+    const auto& ev = obs->receivedEvents[0];
+    REQUIRE(ev.order.getId() == o->getId());
+    REQUIRE(ev.order.price == 42);
+    REQUIRE(ev.order.quantity == 7);
+    REQUIRE(ev.sequence == 1);
 }
 
-TEST_CASE("RemoveOrder emits one RemoveOrderEvent", "[OrderBook]") {
-    OrderBook book;
+TEST_CASE("RemoveOrder emits one REMOVE event", "[OrderBook]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
     auto obs = std::make_shared<RecordingObserver>();
     book.addObserver(obs);
 
@@ -52,13 +52,14 @@ TEST_CASE("RemoveOrder emits one RemoveOrderEvent", "[OrderBook]") {
 
     REQUIRE(obs->receivedEvents.size() == 1);
     REQUIRE(countType(obs->receivedEvents, OrderEventType::REMOVE) == 1);
-    auto ev = std::dynamic_pointer_cast<RemoveOrderEvent>(obs->receivedEvents[0]);
-    REQUIRE(ev);
-    REQUIRE(ev->getOrder()->getId() == o->getId());
+    const auto& ev = obs->receivedEvents[0];
+    REQUIRE(ev.order.getId() == o->getId());
+    REQUIRE(ev.order.side == OrderType::SELL);
+    REQUIRE(ev.sequence == 2);
 }
 
-TEST_CASE("Single fill produces exactly one TradeEvent", "[OrderBook][match]") {
-    OrderBook book;
+TEST_CASE("Single fill produces exactly one MATCH event", "[OrderBook][match]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
     auto obs = std::make_shared<RecordingObserver>();
     book.addObserver(obs);
 
@@ -75,19 +76,19 @@ TEST_CASE("Single fill produces exactly one TradeEvent", "[OrderBook][match]") {
     REQUIRE(countType(obs->receivedEvents, OrderEventType::ADD)   == 1);
     REQUIRE(countType(obs->receivedEvents, OrderEventType::MATCH) == 1);
 
-    auto te = std::dynamic_pointer_cast<TradeEvent>(
+    const auto& te =
         *std::find_if(obs->receivedEvents.begin(), obs->receivedEvents.end(),
-            [](auto& e){ return e->getEventType()==OrderEventType::MATCH; })
-    );
-    REQUIRE(te);
-    CHECK(te->getQty() == 5);
-    CHECK(te->getPrice() == 50.0);
-    CHECK(te->getBuyOrder()->getOrderType()  == OrderType::BUY);
-    CHECK(te->getSellOrder()->getOrderType() == OrderType::SELL);
+            [](auto& e){ return e.type==OrderEventType::MATCH; });
+    CHECK(te.quantity == 5);
+    CHECK(te.buyOrder().price == 50);
+    CHECK(te.buyOrder().side  == OrderType::BUY);
+    CHECK(te.sellOrder().side == OrderType::SELL);
+    CHECK(te.buyOrder().getId()  == buy->getId());
+    CHECK(te.sellOrder().getId() == sell->getId());
 }
 
-TEST_CASE("Partial fill leaves remainder and emits one TradeEvent", "[OrderBook][match]") {
-    OrderBook book;
+TEST_CASE("Partial fill leaves remainder and emits one MATCH event", "[OrderBook][match]") {
+    OrderBook book{PriceScale{}, GENERATE(BookStorage::Map, BookStorage::Ladder)};
     auto obs = std::make_shared<RecordingObserver>();
     book.addObserver(obs);
 
@@ -101,9 +102,10 @@ TEST_CASE("Partial fill leaves remainder and emits one TradeEvent", "[OrderBook]
     book.addOrder(buy);
 
     REQUIRE(countType(obs->receivedEvents, OrderEventType::MATCH) == 1);
-    auto te = std::dynamic_pointer_cast<TradeEvent>(obs->receivedEvents.back());
-    REQUIRE(te);
-    CHECK(te->getQty() == 4);
+    const auto& te = obs->receivedEvents.back();
+    REQUIRE(te.type == OrderEventType::MATCH);
+    CHECK(te.quantity == 4);
+    CHECK(te.sellOrder().quantity == 6);  // as of the trade
     CHECK(sell->getQuantity() == 6);  // 10−4 left
 }
 
@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#include "Book/LadderLevels.hpp"
+#include "MatchingEngine.hpp"
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+
+using AskLadder = LadderLevels<OrderQueue, std::less<>>;
+using BidLadder = LadderLevels<OrderQueue, std::greater<>>;
+
+// Collects the prices of a side in the order forEach visits them
+template <typename Levels>
+static std::vector<Price> pricesOf(const Levels& levels) {
+    std::vector<Price> prices;
+    levels.forEach([&](Price price, const OrderQueue&) { prices.push_back(price); });
+    return prices;
+}
+
+// ——————————————————————————————————————————
+// LadderLevels
+// ——————————————————————————————————————————
+
+TEST_CASE("Ladder tracks the best level on each side", "[ladder]") {
+    AskLadder asks{16};
+    BidLadder bids{16};
+
+    asks.getOrCreate(105);
+    asks.getOrCreate(101);
+    asks.getOrCreate(103);
+    bids.getOrCreate(95);
+    bids.getOrCreate(99);
+    bids.getOrCreate(97);
+
+    REQUIRE(asks.bestPrice() == 101);
+    REQUIRE(bids.bestPrice() == 99);
+    REQUIRE(pricesOf(asks) == std::vector<Price>{101, 103, 105});
+    REQUIRE(pricesOf(bids) == std::vector<Price>{99, 97, 95});
+
+    // Removing the best moves to the next level in the worse direction
+    asks.eraseBest();
+    bids.erase(99);
+    REQUIRE(asks.bestPrice() == 103);
+    REQUIRE(bids.bestPrice() == 97);
+    REQUIRE(asks.size() == 2);
+    REQUIRE(bids.size() == 2);
+}
+
+TEST_CASE("Ladder re-centres and grows to fit prices outside its window", "[ladder]") {
+    AskLadder asks{8};
+
+    asks.getOrCreate(1000).push_back(OrderFactory::createLimitOrder(1, 1000, OrderType::SELL));
+    asks.getOrCreate(1003);
+
+    // Far outside the initial 8-slot window on both sides of the touch
+    asks.getOrCreate(1050);
+    asks.getOrCreate(990);
+
+    REQUIRE(asks.capacity() >= 61);
+    REQUIRE(asks.bestPrice() == 990);
+    REQUIRE(pricesOf(asks) == std::vector<Price>{990, 1000, 1003, 1050});
+
+    // Levels keep their orders when the window moves
+    REQUIRE(asks.find(1000) != nullptr);
+    REQUIRE(asks.find(1000)->size() == 1);
+    REQUIRE(asks.find(1001) == nullptr);
+    REQUIRE(asks.find(5000) == nullptr);
+}
+
+TEST_CASE("Ladder rejects a price range wider than its maximum", "[ladder]") {
+    AskLadder asks{8, 64};
+    asks.getOrCreate(100);
+
+    REQUIRE_NOTHROW(asks.getOrCreate(163));
+    REQUIRE_THROWS_AS(asks.getOrCreate(164), std::length_error);
+    REQUIRE(asks.size() == 2);
+}
+
+TEST_CASE("Ladder empties cleanly and restarts anywhere", "[ladder]") {
+    BidLadder bids{8};
+    bids.getOrCreate(50);
+    bids.erase(50);
+    REQUIRE(bids.empty());
+
+    bids.getOrCreate(1'000'000);
+    REQUIRE(bids.bestPrice() == 1'000'000);
+    REQUIRE(bids.size() == 1);
+}
+
+// ——————————————————————————————————————————
+// Matching over a ladder
+// ——————————————————————————————————————————
+
+TEST_CASE("Matching over ladders keeps price-time priority", "[ladder][match]") {
+    BidLadder buyBook{8};
+    AskLadder sellBook{8};
+
+    auto first  = OrderFactory::createLimitOrder(2, 100, OrderType::SELL);
+    auto second = OrderFactory::createLimitOrder(3, 100, OrderType::SELL);
+    auto cheap  = OrderFactory::createLimitOrder(1,  99, OrderType::SELL);
+    sellBook.getOrCreate(100).push_back(first);
+    sellBook.getOrCreate(100).push_back(second);
+    sellBook.getOrCreate(99).push_back(cheap);
+
+    auto buy = OrderFactory::createLimitOrder(4, 100, OrderType::BUY);
+    auto trades = MatchingEngine::match(buy, buyBook, sellBook);
+
+    REQUIRE(trades.size() == 3);
+    REQUIRE(trades[0].getSellOrder()->getId() == cheap->getId());
+    REQUIRE(trades[1].getSellOrder()->getId() == first->getId());
+    REQUIRE(trades[2].getSellOrder()->getId() == second->getId());
+    REQUIRE(trades[2].getQty() == 1);
+
+    REQUIRE(sellBook.bestPrice() == 100);
+    REQUIRE(sellBook.bestLevel().front()->getQuantity() == 2);
+    REQUIRE(buyBook.empty());
+}
+
+TEST_CASE("Map and ladder books agree on the resulting book", "[ladder][OrderBook]") {
+    auto storage = GENERATE(BookStorage::Map, BookStorage::Ladder);
+    OrderBook book{PriceScale{}, storage};
+    REQUIRE(book.getStorage() == storage);
+
+    book.addOrder(OrderFactory::createLimitOrder(5, 101, OrderType::SELL));
+    book.addOrder(OrderFactory::createLimitOrder(5, 103, OrderType::SELL));
+    book.addOrder(OrderFactory::createLimitOrder(5,  98, OrderType::BUY));
+    book.addOrder(OrderFactory::createLimitOrder(5,  99, OrderType::BUY));
+
+    // Sweep both ask levels and rest the remainder as the new best bid
+    book.addOrder(OrderFactory::createLimitOrder(12, 104, OrderType::BUY));
+
+    REQUIRE(book.getSellOrders().empty());
+    auto bids = book.getBuyOrders();
+    REQUIRE(bids.size() == 3);
+    REQUIRE(bids.begin()->first == 104);
+    REQUIRE(bids.begin()->second.front()->getQuantity() == 2);
+}
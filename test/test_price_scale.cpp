@@ -0,0 +1,40 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+
+#include "Price.hpp"
+#include "OrderBook.hpp"
+#include "OrderFactory.hpp"
+
+TEST_CASE("PriceScale converts decimal prices to whole ticks", "[price]") {
+    PriceScale cents{0.01};
+
+    REQUIRE(cents.toTicks(100.00) == 10000);
+    REQUIRE(cents.toTicks(100.07) == 10007);   // not exactly representable as a double
+    REQUIRE(cents.toTicks(0.0)    == 0);
+    REQUIRE(cents.toTicks(-1.25)  == -125);
+    REQUIRE(cents.toDouble(10007) == cents.toDouble(cents.toTicks(100.07)));
+}
+
+TEST_CASE("PriceScale rejects off-grid prices and bad tick sizes", "[price]") {
+    PriceScale quarters{0.25};
+
+    REQUIRE(quarters.toTicks(10.75) == 43);
+    REQUIRE_THROWS_AS(quarters.toTicks(10.10), std::invalid_argument);
+
+    REQUIRE_THROWS_AS(PriceScale{0.0},  std::invalid_argument);
+    REQUIRE_THROWS_AS(PriceScale{-0.5}, std::invalid_argument);
+}
+
+TEST_CASE("OrderBook keys levels by exact tick price", "[price][OrderBook]") {
+    OrderBook book{PriceScale{0.01}};
+    const PriceScale& scale = book.getPriceScale();
+    REQUIRE(scale.getTickSize() == 0.01);
+
+    // 0.1 + 0.2 != 0.3 as doubles, but both land on the same tick
+    auto o = OrderFactory::createLimitOrder(5, scale.toTicks(0.1 + 0.2), OrderType::SELL);
+    book.addOrder(o);
+    REQUIRE(book.getSellOrders().count(scale.toTicks(0.3)) == 1);
+
+    book.removeOrder(o);
+    REQUIRE(book.getSellOrders().empty());
+}
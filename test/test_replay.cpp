@@ -0,0 +1,133 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "Engine/Replay.hpp"
+#include "Events/JournalReader.hpp"
+#include "Events/JsonlReader.hpp"
+#include "Observer/EventJournal.hpp"
+#include "Observer/TradeLog.hpp"
+
+namespace {
+    template <typename Reader>
+    std::vector<OrderEvent> readAll(Reader reader) {
+        std::vector<OrderEvent> events;
+        OrderEvent ev;
+        while (reader.next(ev)) events.push_back(ev);
+        return events;
+    }
+
+    struct TradeCount : IOrderObserver {
+        std::uint64_t trades   = 0;
+        std::uint64_t modifies = 0;
+        void onOrderEvent(const OrderEvent& ev) override {
+            if (ev.type == OrderEventType::MATCH) ++trades;
+            if (ev.type == OrderEventType::MODIFY) ++modifies;
+        }
+    };
+}
+
+TEST_CASE("Replaying a capture rebuilds the captured book", "[replay]") {
+    const std::string jsonName = "replay_capture.jsonl";
+    const std::string binName = "replay_capture.journal";
+
+    // Capture some order flow in both formats
+    OrderBook live;
+    auto trades = std::make_shared<TradeCount>();
+    std::uint64_t cancels = 0;
+    {
+        auto log = std::make_shared<TradeLog>(jsonName);
+        auto journal = std::make_shared<EventJournal>(binName);
+        live.addObserver(log);
+        live.addObserver(journal);
+        live.addObserver(trades);
+        for (int i = 0; i < 300; ++i) {
+            const OrderType side = i % 3 ? OrderType::SELL : OrderType::BUY;
+            live.addOrder("o" + std::to_string(i), side, side == OrderType::SELL ? 100 + i % 4 : 98 + i % 5, 1 + i % 3);
+            // Cancels of orders already filled raise no event and are not captured
+            if (i % 10 == 9 && live.cancel("o" + std::to_string(i - 4))) ++cancels;
+            // Shrinks in place, or moves (and sometimes crosses)
+            if (i % 7 == 6) live.modify("o" + std::to_string(i - 3), 1 + i % 2, 99 + i % 4);
+        }
+        live.removeObserver(log);
+        live.removeObserver(journal);
+    }
+    REQUIRE(trades->trades > 0);
+    REQUIRE(trades->modifies > 0);
+
+    const auto fromJsonl = readAll(JsonlReader{jsonName});
+    const auto fromJournal = readAll(JournalReader{binName});
+    REQUIRE(fromJsonl.size() == fromJournal.size());
+
+    for (const auto* events : {&fromJsonl, &fromJournal}) {
+        OrderBook book;
+        const ReplayReport report = replay(book, *events);
+        CHECK(report.messages == 300 + cancels + trades->modifies);
+        CHECK(report.rejected == 0);
+        CHECK(report.trades == trades->trades);
+        CHECK(report.capturedTrades == trades->trades);
+        CHECK(report.checksum == bookChecksum(live));
+        CHECK(book.getOrderCount() == live.getOrderCount());
+    }
+
+    std::remove(jsonName.c_str());
+    std::remove(binName.c_str());
+}
+
+TEST_CASE("Replay paces events when given a speed", "[replay]") {
+    std::vector<OrderEvent> events(2);
+    for (std::size_t i = 0; i < events.size(); ++i) {
+        events[i].type = OrderEventType::ADD;
+        events[i].order.setId(std::to_string(i));
+        events[i].order.side = OrderType::BUY;
+        events[i].order.price = 10;
+        events[i].order.quantity = 1;
+        events[i].timestamp = std::chrono::system_clock::time_point{} + std::chrono::milliseconds{100 * i};
+    }
+
+    OrderBook book;
+    // 100 ms apart in the capture, 20 ms apart at 5x
+    const ReplayReport report = replay(book, events, ReplayOptions{5});
+    CHECK(report.seconds >= 0.019);
+    CHECK(report.messages == 2);
+}
+
+TEST_CASE("JsonlReader parses the TradeLog schema and rejects anything else", "[replay]") {
+    const std::string name = "replay_parse.jsonl";
+    {
+        std::ofstream out(name);
+        out << "{\"type\": \"add\", \"order_id\": \"A1\", \"side\": \"BUY\", \"price\": 100, \"quantity\": 5, \"timestamp\": 7}\n"
+               "\n"
+               "{\"type\":\"cancel\",\"order_id\":\"A1\",\"side\":\"BUY\",\"timestamp\":8}\n"
+               "{\"type\":\"match\",\"buy_id\":\"B\",\"sell_id\":\"S\",\"price\":101,\"quantity\":2,\"timestamp\":9}\n"
+               "{\"type\":\"add\",\"order_id\":\"A2\",\"side\":\"UP\",\"price\":1,\"quantity\":1,\"timestamp\":9}\n";
+    }
+
+    JsonlReader reader{name};
+    OrderEvent ev;
+    REQUIRE(reader.next(ev));
+    CHECK(ev.type == OrderEventType::ADD);
+    CHECK(ev.order.getId() == "A1");
+    CHECK(ev.order.price == 100);
+    CHECK(ev.order.quantity == 5);
+    CHECK(ev.timestamp.time_since_epoch() == std::chrono::milliseconds{7});
+
+    REQUIRE(reader.next(ev));
+    CHECK(ev.type == OrderEventType::REMOVE);
+    CHECK(ev.sequence == 2);
+
+    REQUIRE(reader.next(ev));
+    CHECK(ev.type == OrderEventType::MATCH);
+    CHECK(ev.sellOrder().getId() == "S");
+    CHECK(ev.quantity == 2);
+
+    CHECK_THROWS_AS(reader.next(ev), std::runtime_error);
+    std::remove(name.c_str());
+}
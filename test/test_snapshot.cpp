@@ -0,0 +1,253 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "OrderBook.hpp"
+#include "Book/BookSnapshot.hpp"
+#include "Events/JournalReader.hpp"
+#include "Observer/EventJournal.hpp"
+
+namespace {
+    // Every resting order as (id, quantity), side by side in priority order
+    using Resting = std::vector<std::pair<std::string, int>>;
+
+    Resting resting(const OrderBook& book) {
+        Resting all;
+        for (const auto& [price, orders] : book.getSellOrders())
+            for (const auto& o : orders) all.emplace_back(o->getId(), o->getQuantity());
+        for (const auto& [price, orders] : book.getBuyOrders())
+            for (const auto& o : orders) all.emplace_back(o->getId(), o->getQuantity());
+        return all;
+    }
+
+    void fill(OrderBook& book, int first, int count) {
+        for (int i = first; i < first + count; ++i) {
+            const std::string id = std::to_string(i);
+            const OrderType side = i % 2 ? OrderType::BUY : OrderType::SELL;
+            // Sells rest at 100.., buys at ..99; every 7th buy crosses
+            const Price price = side == OrderType::SELL ? 100 + i % 5 : (i % 7 == 0 ? 101 : 99 - i % 5);
+            book.addOrder(id, side, price, 1 + i % 4);
+            if (i % 11 == 0) book.cancel(std::to_string(i - 3));
+        }
+    }
+
+    struct Files {
+        std::string snapshot, journal;
+        ~Files() {
+            std::remove(snapshot.c_str());
+            std::remove(journal.c_str());
+        }
+    };
+}
+
+TEST_CASE("A snapshot restores every order in priority order", "[snapshot]") {
+    const Files files{"snapshot_roundtrip.bin", ""};
+    const BookStorage storage = GENERATE(BookStorage::Map, BookStorage::Ladder);
+
+    OrderBook original{PriceScale{0.5}, storage};
+    fill(original, 0, 200);
+    original.saveSnapshot(files.snapshot, 42);
+
+    OrderBook restored{PriceScale{0.5}, storage};
+    REQUIRE(restored.loadSnapshot(files.snapshot).sequence == 42);
+    REQUIRE(restored.getOrderCount() == original.getOrderCount());
+    REQUIRE(resting(restored) == resting(original));
+
+    // Time priority within each level survives: both books fill alike
+    original.addOrder("sweep", OrderType::BUY, 103, 30);
+    restored.addOrder("sweep", OrderType::BUY, 103, 30);
+    CHECK(resting(restored) == resting(original));
+}
+
+TEST_CASE("Snapshot loading rejects what it cannot restore", "[snapshot]") {
+    const Files files{"snapshot_errors.bin", ""};
+    OrderBook book{PriceScale{0.01}};
+    book.addOrder("1", OrderType::BUY, 10, 1);
+    book.saveSnapshot(files.snapshot, 1);
+
+    CHECK_THROWS_AS(book.loadSnapshot(files.snapshot), std::runtime_error);
+
+    OrderBook otherTicks{PriceScale{0.05}};
+    CHECK_THROWS_AS(otherTicks.loadSnapshot(files.snapshot), std::invalid_argument);
+
+    {
+        std::ofstream junk(files.snapshot, std::ios::trunc);
+        junk << "not a snapshot at all, but long enough to hold a header....";
+    }
+    OrderBook fresh{PriceScale{0.01}};
+    CHECK_THROWS_AS(fresh.loadSnapshot(files.snapshot), std::runtime_error);
+    CHECK_THROWS_AS(fresh.loadSnapshot("no_such_snapshot.bin"), std::runtime_error);
+}
+
+TEST_CASE("A snapshot that fails part way loads nothing", "[snapshot]") {
+    const Files files{"snapshot_duplicate.bin", ""};
+    {
+        OrderBook book;
+        book.addOrder("a", OrderType::SELL, 101, 1);
+        book.addOrder("b", OrderType::SELL, 102, 1);
+        book.addOrder("c", OrderType::BUY, 99, 1);
+        book.saveSnapshot(files.snapshot, 7);
+    }
+    // Rename the last order to "a"
+    {
+        std::fstream file(files.snapshot, std::ios::in | std::ios::out | std::ios::binary);
+        const auto last = static_cast<std::streamoff>(std::filesystem::file_size(files.snapshot) - sizeof(SnapshotOrder));
+        SnapshotOrder order;
+        file.seekg(last);
+        file.read(reinterpret_cast<char*>(&order), sizeof(order));
+        order.id[0] = 'a';
+        file.seekp(last);
+        file.write(reinterpret_cast<const char*>(&order), sizeof(order));
+    }
+
+    OrderBook book;
+    CHECK_THROWS_AS(book.loadSnapshot(files.snapshot), std::invalid_argument);
+    CHECK(book.getOrderCount() == 0);
+    CHECK(book.getSellOrders().empty());
+    CHECK_FALSE(book.getTopOfBook().hasAsk());
+
+    // Still usable, and still empty enough to load into
+    book.addOrder("a", OrderType::BUY, 50, 1);
+    CHECK(book.cancel("a"));
+}
+
+TEST_CASE("Recovery loads the snapshot and replays only the journal tail", "[snapshot][journal]") {
+    const Files files{"recover.snapshot", "recover.journal"};
+    const std::string sequenceOnly = "recover_sequence_only.snapshot";
+
+    OrderBook live;
+    auto journal = std::make_shared<EventJournal>(files.journal);
+    live.addObserver(journal);
+    fill(live, 0, 100);
+    live.addOrder("text-a", OrderType::BUY, 90, 5);   // interned before the snapshot
+    const JournalCheckpoint taken = journal->checkpoint();
+    live.saveSnapshot(files.snapshot, taken);
+    live.saveSnapshot(sequenceOnly, taken.sequence);
+    fill(live, 100, 100);
+    live.cancel("text-a");                            // used by the tail only
+    live.addOrder("text-b", OrderType::SELL, 120, 5);
+    journal->sync();
+
+    SECTION("from the snapshot and the tail, without reading what came before") {
+        // Wreck every record the snapshot already reflects
+        {
+            std::fstream file(files.journal, std::ios::in | std::ios::out | std::ios::binary);
+            file.seekp(sizeof(JournalFileHeader));
+            const std::string zeros(taken.offset - sizeof(JournalFileHeader), '\0');
+            file.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+        }
+        OrderBook recovered;
+        const JournalCheckpoint end = recovered.recover(files.snapshot, files.journal);
+        CHECK(end.sequence == journal->getLastSequence());
+        CHECK(end.offset == std::filesystem::file_size(files.journal));
+        CHECK(end.nextOrderId == 200);
+        CHECK(resting(recovered) == resting(live));
+    }
+
+    SECTION("from the whole journal when the snapshot has only a sequence") {
+        OrderBook recovered;
+        CHECK(recovered.recover(sequenceOnly, files.journal).sequence == journal->getLastSequence());
+        CHECK(resting(recovered) == resting(live));
+    }
+
+    SECTION("from the whole journal when there is no snapshot") {
+        std::remove(files.snapshot.c_str());
+        OrderBook recovered;
+        CHECK(recovered.recover(files.snapshot, files.journal).sequence == journal->getLastSequence());
+        CHECK(resting(recovered) == resting(live));
+    }
+
+    SECTION("not from a journal that does not continue the snapshot") {
+        journal->close();
+        OrderBook unrelated;
+        auto rewritten = std::make_shared<EventJournal>(files.journal);
+        unrelated.addObserver(rewritten);
+        fill(unrelated, 0, 150);
+        rewritten->sync();
+        OrderBook recovered;
+        CHECK_THROWS_AS(recovered.recover(files.snapshot, files.journal), std::runtime_error);
+    }
+    std::remove(sequenceOnly.c_str());
+}
+
+TEST_CASE("A journal continued from recovery is not read again", "[snapshot][journal]") {
+    const Files files{"continue.snapshot", "continue.journal"};
+
+    OrderBook live;
+    {
+        auto journal = std::make_shared<EventJournal>(files.journal);
+        live.addObserver(journal);
+        fill(live, 0, 50);
+        live.addOrder("text-a", OrderType::BUY, 90, 5);
+        live.saveSnapshot(files.snapshot, journal->checkpoint());
+        fill(live, 50, 10);
+        live.removeObserver(journal);
+    }
+
+    OrderBook recovered;
+    const JournalCheckpoint end = recovered.recover(files.snapshot, files.journal);
+    {
+        // Cut back to what recovery read, then carries on its numbering
+        std::ofstream(files.journal, std::ios::binary | std::ios::app) << "torn";
+        auto journal = std::make_shared<EventJournal>(files.journal, end);
+        REQUIRE(journal->getLastSequence() == end.sequence);
+        recovered.addObserver(journal);
+        recovered.cancel("text-a");
+        recovered.addOrder("text-b", OrderType::SELL, 120, 2);
+        recovered.addOrder("77", OrderType::BUY, 95, 1);
+        const JournalCheckpoint after = journal->checkpoint();
+        CHECK(after.nextOrderId == 78);
+        recovered.saveSnapshot(files.snapshot, after);
+        REQUIRE(recovered.modify("text-b", 1, 120));
+        recovered.addOrder("text-c", OrderType::BUY, 96, 1);
+        recovered.removeObserver(journal);
+    }
+
+    JournalReader reader{files.journal};
+    OrderEvent ev;
+    std::uint64_t expected = 1;
+    while (reader.next(ev)) CHECK(ev.sequence == expected++);
+    CHECK_FALSE(reader.truncated());
+
+    // The second snapshot's tail names text-b, interned after the restart and
+    // before that snapshot
+    OrderBook again;
+    again.recover(files.snapshot, files.journal);
+    CHECK(resting(again) == resting(recovered));
+}
+
+TEST_CASE("An appended journal continues the sequence and ids after a torn record", "[journal]") {
+    const Files files{"", "append.journal"};
+
+    OrderEvent ev{};
+    ev.type = OrderEventType::ADD;
+    {
+        EventJournal journal{files.journal};
+        ev.order.setId("alpha");
+        journal.onOrderEvent(ev);
+        ev.order.setId("7");
+        journal.onOrderEvent(ev);
+    }
+    std::filesystem::resize_file(files.journal, std::filesystem::file_size(files.journal) - 5);
+    {
+        EventJournal journal{files.journal, EventJournal::defaultBufferSize, JournalOpen::Append};
+        REQUIRE(journal.getLastSequence() == 1);
+        ev.order.setId("alpha");
+        journal.onOrderEvent(ev);
+        ev.order.setId("beta");
+        journal.onOrderEvent(ev);
+    }
+
+    JournalReader reader{files.journal};
+    std::vector<std::pair<std::uint64_t, std::string>> read;
+    while (reader.next(ev)) read.emplace_back(ev.sequence, std::string(ev.order.getId()));
+    CHECK_FALSE(reader.truncated());
+    CHECK(read == std::vector<std::pair<std::uint64_t, std::string>>{{1, "alpha"}, {2, "alpha"}, {3, "beta"}});
+}
@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+#include "OrderBook.hpp"
+#include "Stats/BookStats.hpp"
+#include "Stats/LatencyHistogram.hpp"
+
+TEST_CASE("LatencyHistogram buckets are contiguous and tight", "[stats]") {
+    std::size_t expected = 0;
+    for (std::uint64_t v = 0; v < 100'000; ++v) {
+        const std::size_t bucket = LatencyHistogram::bucketOf(v);
+        REQUIRE(bucket >= expected);
+        REQUIRE(bucket <= expected + 1);
+        expected = bucket;
+        REQUIRE(LatencyHistogram::bucketTop(bucket) >= v);
+        // Within ~3% of the value it stands for
+        REQUIRE(static_cast<double>(LatencyHistogram::bucketTop(bucket) - v) <= 0.032 * static_cast<double>(v) + 0.5);
+    }
+    REQUIRE(LatencyHistogram::bucketOf(UINT64_MAX) == LatencyHistogram::bucketCount - 1);
+}
+
+TEST_CASE("LatencyHistogram reports percentiles and the maximum", "[stats]") {
+    LatencyHistogram histogram;
+    CHECK(histogram.percentile(0.5) == 0);
+
+    for (std::uint64_t v = 1; v <= 1000; ++v) histogram.record(v);
+    histogram.record(1'000'000);
+
+    CHECK(histogram.count() == 1001);
+    CHECK(histogram.max() == 1'000'000);
+    const auto p50 = histogram.percentile(0.50);
+    CHECK(p50 >= 500);
+    CHECK(p50 <= 516);
+    const auto p99 = histogram.percentile(0.99);
+    CHECK(p99 >= 990);
+    CHECK(p99 <= 1023);
+    CHECK(histogram.percentile(1.0) == 1'000'000);
+}
+
+TEST_CASE("OrderBook times its operations and counts the levels a match walks", "[stats]") {
+    OrderBook book;
+    for (int level = 0; level < 3; ++level) {
+        book.addOrder("ask" + std::to_string(level), OrderType::SELL, 100 + level, 1);
+    }
+    book.addOrder("resting", OrderType::SELL, 200, 1);
+    book.cancel("resting");
+    book.cancel("missing");
+    book.addOrder("sweep", OrderType::BUY, 102, 3);
+
+    const BookStatsSnapshot stats = book.getStats();
+    std::ostringstream dump;
+    dumpStats(dump, stats);
+
+    if constexpr (statsEnabled) {
+        CHECK(stats.enabled);
+        CHECK(stats.orderCount == 0);
+        CHECK(stats.add.count == 5);
+        CHECK(stats.cancel.count == 1);   // only cancels that found their order
+        CHECK(stats.match.count == 5);
+        CHECK(stats.levelsWalked.count == 1);
+        CHECK(stats.levelsWalked.max == 3);
+        CHECK(stats.add.max >= stats.add.p50);
+        CHECK(dump.str().find("levels/match") != std::string::npos);
+    } else {
+        CHECK_FALSE(stats.enabled);
+        CHECK(dump.str().find("not built in") != std::string::npos);
+    }
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "BasicOrderBook.hpp"
+#include "Engine/MultiBookEngine.hpp"
+#include "OrderBook.hpp"
+
+// ——————————————————————————————————————————
+// Best bid/offer
+// ——————————————————————————————————————————
+
+using MapTopBook    = BasicOrderBook<PooledOrders, MapPrices>;
+using LadderTopBook = BasicOrderBook<PooledOrders, LadderPrices>;
+
+TEMPLATE_TEST_CASE("The top of book follows adds, fills and cancels", "[TopOfBook]", MapTopBook, LadderTopBook) {
+    TestType book;
+    REQUIRE_FALSE(book.getTopOfBook().hasBid());
+    REQUIRE_FALSE(book.getTopOfBook().hasAsk());
+
+    book.addOrder("b1", OrderType::BUY, 98, 5);
+    book.addOrder("b2", OrderType::BUY, 99, 2);
+    book.addOrder("b3", OrderType::BUY, 99, 3);
+    book.addOrder("s1", OrderType::SELL, 102, 4);
+    REQUIRE(book.getBestBid() == DepthLevel{99, 5, 2});
+    REQUIRE(book.getBestAsk() == DepthLevel{102, 4, 1});
+    REQUIRE(book.getTopOfBook().spread() == 3);
+
+    // Takes b2 and part of b3
+    book.addOrder("s2", OrderType::SELL, 99, 4);
+    REQUIRE(book.getBestBid() == DepthLevel{99, 1, 1});
+
+    // Empties the best bid level; the next one takes over
+    REQUIRE(book.cancel("b3"));
+    REQUIRE(book.getBestBid() == DepthLevel{98, 5, 1});
+
+    // Improves the offer
+    book.addOrder("s3", OrderType::SELL, 100, 1);
+    REQUIRE(book.getBestAsk() == DepthLevel{100, 1, 1});
+    REQUIRE(book.getTopOfBook().spread() == 2);
+    REQUIRE(book.loadTopOfBook() == book.getTopOfBook());
+
+    REQUIRE(book.cancel("s3"));
+    REQUIRE(book.cancel("s1"));
+    REQUIRE_FALSE(book.getTopOfBook().hasAsk());
+    REQUIRE(book.loadTopOfBook() == book.getTopOfBook());
+}
+
+TEST_CASE("Readers on other threads only ever see a top of book that existed", "[TopOfBook]") {
+    // Each step leaves a single bid whose quantity equals its price, so a
+    // torn read would show up as a mismatch
+    MapTopBook book;
+    std::atomic<bool> done{false};
+    std::atomic<int>  seen{0};
+    std::atomic<int>  torn{0};
+
+    std::thread reader([&] {
+        while (!done.load(std::memory_order_acquire)) {
+            const TopOfBook top = book.loadTopOfBook();
+            if (top.hasBid()) {
+                seen.fetch_add(1, std::memory_order_relaxed);
+                if (top.bid.quantity != top.bid.price || top.bid.orderCount != 1) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        }
+    });
+
+    for (int i = 1; i <= 20000; ++i) {
+        book.addOrder(std::to_string(i), OrderType::BUY, i, i);
+        book.cancel(std::to_string(i - 1));
+    }
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    REQUIRE(torn.load() == 0);
+    REQUIRE(book.loadTopOfBook().bid == DepthLevel{20000, 20000, 1});
+}
+
+TEST_CASE("MultiBookEngine reads each symbol's top of book", "[TopOfBook][MultiBookEngine]") {
+    MultiBookEngine<> engine({"AAA", "BBB"}, EngineOptions{2, RunnerOptions{}});
+    engine.start();
+    REQUIRE(engine.addOrder("AAA", "a1", OrderType::BUY, 100, 3));
+    REQUIRE(engine.addOrder("BBB", "b1", OrderType::SELL, 205, 7));
+    engine.stop();
+
+    REQUIRE(engine.topOfBook("AAA").bid == DepthLevel{100, 3, 1});
+    REQUIRE_FALSE(engine.topOfBook("AAA").hasAsk());
+    REQUIRE(engine.topOfBook("BBB").ask == DepthLevel{205, 7, 1});
+    REQUIRE_THROWS_AS(engine.topOfBook("CCC"), std::invalid_argument);
+}
@@ -5,16 +5,34 @@
 #include <cstdio>
 #include <memory>
 #include <filesystem>
+#include <thread>
+#include <vector>
 #include <string>
 
 #include "Observer/TradeLog.hpp"
-#include "Events/AddOrderEvent.hpp"
-#include "Events/RemoveOrderEvent.hpp"
-#include "Events/TradeEvent.hpp"
+#include "Events/OrderEvent.hpp"
 #include "OrderFactory.hpp"
 
 namespace fs = std::filesystem;
 
+// Builds the event the book would raise for an order (or a trade between two)
+static OrderEvent makeEvent(OrderEventType type, const IOrder& order, const IOrder* contra = nullptr, int qty = 0) {
+    auto snapshot = [](OrderSnapshot& into, const IOrder& o) {
+        into.setId(o.getId());
+        into.side     = o.getOrderType();
+        into.price    = o.getPrice();
+        into.quantity = o.getQuantity();
+    };
+    OrderEvent ev{};
+    ev.type      = type;
+    ev.sequence  = 1;
+    ev.timestamp = std::chrono::system_clock::now();
+    snapshot(ev.order, order);
+    if (contra) snapshot(ev.contra, *contra);
+    ev.quantity  = contra ? qty : order.getQuantity();
+    return ev;
+}
+
 // Helper to read exactly one nonempty line and normalize line endings
 static std::string loadOneLine(const std::string& fname) {
     std::ifstream in(fname);
@@ -28,6 +46,17 @@ static std::string loadOneLine(const std::string& fname) {
     return "";
 }
 
+// Number of nonempty lines in a file
+static std::size_t countLines(const std::string& fname) {
+    std::ifstream in(fname);
+    std::size_t lines = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty()) ++lines;
+    }
+    return lines;
+}
+
 //------------------[ ADD ]-------------------
 TEST_CASE("TradeLog logs ADD events as JSON", "[TradeLog][ADD]") {
     const std::string fname = "tradelog_add.jsonl";
@@ -35,8 +64,7 @@ TEST_CASE("TradeLog logs ADD events as JSON", "[TradeLog][ADD]") {
 
     TradeLog log{fname};
     auto o = OrderFactory::createLimitOrder(2, 10, OrderType::BUY);
-    auto ev = std::make_shared<AddOrderEvent>(o);
-    log.onOrderEvent(ev);
+    log.onOrderEvent(makeEvent(OrderEventType::ADD, *o));
 
     std::string line = loadOneLine(fname);
     CHECK(line.starts_with("{\"type\":\"add\""));
@@ -56,8 +84,7 @@ TEST_CASE("TradeLog logs REMOVE events as JSON", "[TradeLog][REMOVE]") {
 
     TradeLog log{fname};
     auto o = OrderFactory::createLimitOrder(5, 99, OrderType::SELL);
-    auto ev = std::make_shared<RemoveOrderEvent>(o);
-    log.onOrderEvent(ev);
+    log.onOrderEvent(makeEvent(OrderEventType::REMOVE, *o));
 
     std::string line = loadOneLine(fname);
     CHECK(line.starts_with("{\"type\":\"cancel\""));
@@ -76,8 +103,7 @@ TEST_CASE("TradeLog logs MATCH events as JSON", "[TradeLog][MATCH]") {
     TradeLog log{fname};
     auto sell = OrderFactory::createLimitOrder(3, 20, OrderType::SELL);
     auto buy  = OrderFactory::createLimitOrder(3, 20, OrderType::BUY);
-    auto ev = std::make_shared<TradeEvent>(buy, sell, 3);
-    log.onOrderEvent(ev);
+    log.onOrderEvent(makeEvent(OrderEventType::MATCH, *buy, sell.get(), 3));
 
     std::string line = loadOneLine(fname);
     CHECK(line.starts_with("{\"type\":\"match\""));
@@ -90,8 +116,125 @@ TEST_CASE("TradeLog logs MATCH events as JSON", "[TradeLog][MATCH]") {
     std::remove(fname.c_str());
 }
 
+//------------------[ BLOCK ]-------------------
+TEST_CASE("TradeLog writes a block of events in order", "[TradeLog]") {
+    const std::string fname = "tradelog_block.jsonl";
+    std::remove(fname.c_str());
+
+    TradeLog log{fname};
+    auto o = OrderFactory::createLimitOrder(1, 10, OrderType::BUY);
+    const OrderEvent block[] = {makeEvent(OrderEventType::ADD, *o), makeEvent(OrderEventType::REMOVE, *o)};
+    log.onOrderEvents(block);
+
+    REQUIRE(log.getEvents().size() == 2);
+    CHECK(log.getEvents()[1].type == OrderEventType::REMOVE);
+    CHECK(loadOneLine(fname).starts_with("{\"type\":\"add\""));
+
+    std::remove(fname.c_str());
+}
+
+//------------------[ RETENTION ]-------------------
+TEST_CASE("TradeLog keeps only the most recent events in memory", "[TradeLog]") {
+    const std::string fname = "tradelog_retention.jsonl";
+    std::remove(fname.c_str());
+    auto o = OrderFactory::createLimitOrder(1, 10, OrderType::BUY);
+    auto numbered = [&](std::uint64_t sequence) {
+        OrderEvent ev = makeEvent(OrderEventType::ADD, *o);
+        ev.sequence = sequence;
+        return ev;
+    };
+
+    SECTION("a ring of the last N") {
+        TradeLog log{fname, TradeLogOptions{.retainEvents = 3}};
+        for (std::uint64_t s = 1; s <= 5; ++s) log.onOrderEvent(numbered(s));
+        REQUIRE(log.getEvents().size() == 3);
+        CHECK(log.getEvents()[0].sequence == 3);
+        CHECK(log.getEvents()[2].sequence == 5);
+
+        // Still in order after further wrapping
+        for (std::uint64_t s = 6; s <= 7; ++s) log.onOrderEvent(numbered(s));
+        CHECK(log.getEvents()[0].sequence == 5);
+        CHECK(log.getEvents()[2].sequence == 7);
+    }
+
+    SECTION("disabled") {
+        TradeLog log{fname, TradeLogOptions{.retainEvents = 0}};
+        log.onOrderEvent(numbered(1));
+        CHECK(log.getEvents().empty());
+    }
+
+    // The file still gets every event
+    CHECK(countLines(fname) >= 1);
+    std::remove(fname.c_str());
+}
+
 //------------------[ CONSTRUCTOR ERROR ]-------------------
 TEST_CASE("TradeLog constructor throws on bad path", "[TradeLog][ERROR]") {
     std::string bad = "/this_path_does_not_exist/log.txt";
     REQUIRE_THROWS_AS(TradeLog{bad}, std::runtime_error);
 }
+
+//------------------[ ASYNC ]-------------------
+TEST_CASE("Async TradeLog writes every event, in order, by close", "[TradeLog][async]") {
+    const std::string fname = "tradelog_async.jsonl";
+    std::remove(fname.c_str());
+
+    // A tiny queue makes the caller wait on the writer
+    TradeLog log{fname, TradeLogOptions{.mode = TradeLogMode::Async, .queueCapacity = 8, .flushEvents = 64,
+                                        .retainEvents = TradeLogOptions::allEvents}};
+    auto o = OrderFactory::createLimitOrder(1, 10, OrderType::BUY);
+    std::vector<OrderEvent> block(10, makeEvent(OrderEventType::ADD, *o));
+    std::uint64_t sequence = 0;
+    for (int i = 0; i < 500; ++i) {
+        for (auto& ev : block) ev.sequence = ++sequence;
+        log.onOrderEvents(block);
+        // Readable while the writer is still retaining events
+        if (i % 100 == 0) CHECK(log.getEvents().size() <= sequence);
+    }
+    log.onOrderEvent(makeEvent(OrderEventType::REMOVE, *o));
+    log.close();
+
+    REQUIRE(countLines(fname) == 5001);
+    const auto events = log.getEvents();
+    REQUIRE(events.size() == 5001);
+    for (std::size_t i = 0; i < 5000; ++i) {
+        REQUIRE(events[i].sequence == i + 1);
+    }
+    CHECK(events.back().type == OrderEventType::REMOVE);
+
+    // Closed: further events are ignored
+    log.onOrderEvent(makeEvent(OrderEventType::ADD, *o));
+    CHECK(log.getEvents().size() == 5001);
+
+    std::remove(fname.c_str());
+}
+
+TEST_CASE("Async TradeLog flushes on sync and on its flush interval", "[TradeLog][async]") {
+    const std::string fname = "tradelog_async_flush.jsonl";
+    std::remove(fname.c_str());
+    auto o = OrderFactory::createLimitOrder(1, 10, OrderType::BUY);
+
+    SECTION("sync() waits for everything logged so far") {
+        // Neither the count nor the interval will trigger a flush
+        TradeLog log{fname, TradeLogOptions{TradeLogMode::Async, 1024, 1'000'000, std::chrono::hours{1}}};
+        log.onOrderEvent(makeEvent(OrderEventType::ADD, *o));
+        log.onOrderEvent(makeEvent(OrderEventType::REMOVE, *o));
+        log.sync();
+
+        CHECK(countLines(fname) == 2);
+        CHECK(log.getEvents().size() == 2);
+    }
+
+    SECTION("a lone event is flushed once the interval passes") {
+        TradeLog log{fname, TradeLogOptions{TradeLogMode::Async, 1024, 1'000'000, std::chrono::microseconds{500}}};
+        log.onOrderEvent(makeEvent(OrderEventType::ADD, *o));
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (countLines(fname) == 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        CHECK(countLines(fname) == 1);
+    }
+
+    std::remove(fname.c_str());
+}